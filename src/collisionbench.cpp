@@ -0,0 +1,49 @@
+#define SDL_MAIN_HANDLED    // Plain console program: no SDL_main / WinMain
+#include "collisionstress.h"
+#include "logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Entry point of boing_collision_bench
+ *
+ * Runs the CollisionStress scenario matrix without a window, a stage or
+ * loaded resources and writes the JSON results:
+ *
+ *   boing_collision_bench [--ticks N] [FILE]
+ *
+ * --ticks sets the timed calls per scenario (default 200), FILE defaults to
+ * collstress.json. Returns 1 if the arguments are invalid or the file could
+ * not be written.
+ */
+int main(int argc, char* argv[])
+{
+    Logger::instance().init(true, LogLevel::INFO);
+
+    int ticks = 200;
+    std::string path = "collstress.json";
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+        {
+            ticks = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (argv[i][0] != '-')
+        {
+            path = argv[i];
+        }
+        else
+        {
+            LOG_ERROR("Unknown or incomplete argument: %s", argv[i]);
+            LOG_INFO("Usage: boing_collision_bench [--ticks N] [FILE]");
+            Logger::destroy();
+            return 1;
+        }
+    }
+
+    int result = CollisionStress::runAll(ticks, path) ? 0 : 1;
+
+    Logger::destroy();
+    return result;
+}
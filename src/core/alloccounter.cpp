@@ -0,0 +1,75 @@
+#include "alloccounter.h"
+
+#ifdef _DEBUG
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<Uint64> allocationCount(0);
+
+    void* countedAlloc(std::size_t size)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    void* p = countedAlloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* p = countedAlloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+bool AllocCounter::isEnabled()
+{
+    return true;
+}
+
+Uint64 AllocCounter::count()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+#else
+
+bool AllocCounter::isEnabled()
+{
+    return false;
+}
+
+Uint64 AllocCounter::count()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * AllocCounter - Counts heap allocations (Debug builds)
+ *
+ * In Debug builds (_DEBUG) the global operator new is replaced by a thin
+ * wrapper around malloc that increments a counter, so a code section can
+ * be checked for allocations by reading count() before and after it:
+ *
+ *   Uint64 before = AllocCounter::count();
+ *   ...
+ *   Uint64 allocations = AllocCounter::count() - before;
+ *
+ * Only allocations through operator new are seen (containers, make_unique,
+ * new expressions); direct malloc calls from SDL or the C runtime are not.
+ *
+ * In Release builds nothing is replaced, isEnabled() returns false and
+ * count() always returns 0.
+ */
+class AllocCounter
+{
+public:
+    static bool isEnabled();
+
+    /**
+     * Total operator new calls since program start (all threads)
+     */
+    static Uint64 count();
+};
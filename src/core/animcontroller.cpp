@@ -5,36 +5,42 @@
 // ============================================================================
 
 FrameSequenceAnim::FrameSequenceAnim(std::vector<int> frameSequence, int durationMs, int loopCount)
-    : frames(std::move(frameSequence))
-    , defaultDuration(durationMs)
+    : defaultDuration(durationMs)
     , loops(loopCount)
     , loopsRemaining(loopCount)
-    , usePerFrameDurations(false)
 {
-    if (frames.empty())
+    auto seq = std::make_shared<Sequence>();
+    seq->frames = std::move(frameSequence);
+    seq->usePerFrameDurations = false;
+
+    if (seq->frames.empty())
     {
-        frames.push_back(0);  // Ensure at least one frame
+        seq->frames.push_back(0);  // Ensure at least one frame
     }
+    sequence = std::move(seq);
 }
 
 FrameSequenceAnim::FrameSequenceAnim(std::vector<int> frameSequence, std::vector<int> durationsMs, int loopCount)
-    : frames(std::move(frameSequence))
-    , frameDurations(std::move(durationsMs))
-    , defaultDuration(100)  // Fallback if frameDurations is empty
+    : defaultDuration(100)  // Fallback if frameDurations is empty
     , loops(loopCount)
     , loopsRemaining(loopCount)
-    , usePerFrameDurations(true)
 {
-    if (frames.empty())
+    auto seq = std::make_shared<Sequence>();
+    seq->frames = std::move(frameSequence);
+    seq->frameDurations = std::move(durationsMs);
+    seq->usePerFrameDurations = true;
+
+    if (seq->frames.empty())
     {
-        frames.push_back(0);  // Ensure at least one frame
+        seq->frames.push_back(0);  // Ensure at least one frame
     }
 
     // Ensure frameDurations matches frames size
-    if (frameDurations.size() < frames.size())
+    if (seq->frameDurations.size() < seq->frames.size())
     {
-        frameDurations.resize(frames.size(), defaultDuration);
+        seq->frameDurations.resize(seq->frames.size(), defaultDuration);
     }
+    sequence = std::move(seq);
 }
 
 FrameSequenceAnim FrameSequenceAnim::range(int startFrame, int endFrame, int durationMs, int loopCount)
@@ -66,11 +72,12 @@ void FrameSequenceAnim::update(float dt)
 {
     if (complete) return;
 
+    const Sequence& seq = *sequence;
     timeAccumulator += dt;
 
     // Get current frame duration
-    int currentDuration = usePerFrameDurations && currentIndex < static_cast<int>(frameDurations.size())
-                          ? frameDurations[currentIndex]
+    int currentDuration = seq.usePerFrameDurations && currentIndex < static_cast<int>(seq.frameDurations.size())
+                          ? seq.frameDurations[currentIndex]
                           : defaultDuration;
 
     if (timeAccumulator >= currentDuration)
@@ -78,7 +85,7 @@ void FrameSequenceAnim::update(float dt)
         timeAccumulator -= currentDuration;
         currentIndex++;
 
-        if (currentIndex >= static_cast<int>(frames.size()))
+        if (currentIndex >= static_cast<int>(seq.frames.size()))
         {
             // End of sequence reached
             if (loops == 0)
@@ -95,7 +102,7 @@ void FrameSequenceAnim::update(float dt)
             else
             {
                 // Final loop complete
-                currentIndex = static_cast<int>(frames.size()) - 1;
+                currentIndex = static_cast<int>(seq.frames.size()) - 1;
                 complete = true;
                 if (onComplete)
                 {
@@ -108,6 +115,7 @@ void FrameSequenceAnim::update(float dt)
 
 int FrameSequenceAnim::getCurrentFrame() const
 {
+    const std::vector<int>& frames = sequence->frames;
     if (currentIndex >= 0 && currentIndex < static_cast<int>(frames.size()))
     {
         return frames[currentIndex];
@@ -155,6 +163,39 @@ void ToggleAnim::reset()
 // StateMachineAnim Implementation
 // ============================================================================
 
+StateMachineAnim::Definition& StateMachineAnim::editDefinition()
+{
+    if (!def)
+        def = std::make_shared<Definition>();
+    else if (def.use_count() > 1)
+        def = std::make_shared<Definition>(*def);  // Other clones keep the old table
+    return *def;
+}
+
+void StateMachineAnim::storeState(const std::string& name, State state)
+{
+    Definition& d = editDefinition();
+
+    auto it = d.ids.find(name);
+    if (it != d.ids.end())
+    {
+        d.states[it->second] = std::move(state);
+    }
+    else
+    {
+        d.ids[name] = (int)d.states.size();
+        d.names.push_back(name);
+        d.states.push_back(std::move(state));
+    }
+
+    // Resolve transitions by id (targets may be added after their sources)
+    for (State& st : d.states)
+    {
+        auto next = st.nextState.empty() ? d.ids.end() : d.ids.find(st.nextState);
+        st.next = (next != d.ids.end()) ? next->second : -1;
+    }
+}
+
 void StateMachineAnim::addState(const std::string& name, std::vector<int> frames,
                                  int durationMs, int loopCount, const std::string& nextState)
 {
@@ -162,7 +203,6 @@ void StateMachineAnim::addState(const std::string& name, std::vector<int> frames
     state.frames = std::move(frames);
     state.defaultDuration = durationMs;
     state.loops = loopCount;
-    state.loopsRemaining = loopCount;
     state.usePerFrameDurations = false;
     state.nextState = nextState;
 
@@ -171,7 +211,7 @@ void StateMachineAnim::addState(const std::string& name, std::vector<int> frames
         state.frames.push_back(0);  // Ensure at least one frame
     }
 
-    states[name] = std::move(state);
+    storeState(name, std::move(state));
 }
 
 void StateMachineAnim::addState(const std::string& name, std::vector<int> frames,
@@ -182,7 +222,6 @@ void StateMachineAnim::addState(const std::string& name, std::vector<int> frames
     state.frameDurations = std::move(durationsMs);
     state.defaultDuration = 100;  // Fallback
     state.loops = loopCount;
-    state.loopsRemaining = loopCount;
     state.usePerFrameDurations = true;
     state.nextState = nextState;
 
@@ -197,31 +236,46 @@ void StateMachineAnim::addState(const std::string& name, std::vector<int> frames
         state.frameDurations.resize(state.frames.size(), state.defaultDuration);
     }
 
-    states[name] = std::move(state);
+    storeState(name, std::move(state));
+}
+
+void StateMachineAnim::enterState(int id)
+{
+    currentState = id;
+    currentIndex = 0;
+    timeAccumulator = 0.0f;
+    stateComplete = false;
+    // Reset loop counter for this state
+    loopsRemaining = def->states[id].loops;
+}
+
+StateMachineAnim::StateId StateMachineAnim::findState(const std::string& name) const
+{
+    if (!def) return NO_STATE;
+
+    auto it = def->ids.find(name);
+    return it != def->ids.end() ? it->second : NO_STATE;
 }
 
-void StateMachineAnim::setState(const std::string& name)
+void StateMachineAnim::setState(StateId id)
 {
-    auto it = states.find(name);
-    if (it != states.end())
+    if (def && id >= 0 && id < static_cast<int>(def->states.size()))
     {
-        currentStateName = name;
-        currentIndex = 0;
-        timeAccumulator = 0.0f;
-        stateComplete = false;
-        // Reset loop counter for this state
-        it->second.loopsRemaining = it->second.loops;
+        enterState(id);
     }
 }
 
-void StateMachineAnim::update(float dt)
+const std::string& StateMachineAnim::getStateName(StateId id) const
 {
-    if (currentStateName.empty()) return;
+    static const std::string none;
+    return (def && id >= 0 && id < static_cast<int>(def->names.size())) ? def->names[id] : none;
+}
 
-    auto it = states.find(currentStateName);
-    if (it == states.end()) return;
+void StateMachineAnim::update(float dt)
+{
+    if (currentState < 0) return;
 
-    State& state = it->second;  // Non-const to modify loopsRemaining
+    const State& state = def->states[currentState];
 
     timeAccumulator += dt;
 
@@ -243,10 +297,10 @@ void StateMachineAnim::update(float dt)
                 // Infinite loop
                 currentIndex = 0;
             }
-            else if (state.loopsRemaining > 1)
+            else if (loopsRemaining > 1)
             {
                 // Still have loops remaining
-                state.loopsRemaining--;
+                loopsRemaining--;
                 currentIndex = 0;
             }
             else
@@ -254,17 +308,18 @@ void StateMachineAnim::update(float dt)
                 // Final loop complete
                 currentIndex = static_cast<int>(state.frames.size()) - 1;
                 stateComplete = true;
+                int next = state.next;
 
                 // Callback before auto-transition
                 if (onStateComplete)
                 {
-                    onStateComplete(currentStateName);
+                    onStateComplete(currentState);
                 }
 
                 // Auto-transition to next state if specified
-                if (!state.nextState.empty())
+                if (next >= 0)
                 {
-                    setState(state.nextState);
+                    enterState(next);
                 }
             }
         }
@@ -273,12 +328,9 @@ void StateMachineAnim::update(float dt)
 
 int StateMachineAnim::getCurrentFrame() const
 {
-    if (currentStateName.empty()) return 0;
+    if (currentState < 0) return 0;
 
-    auto it = states.find(currentStateName);
-    if (it == states.end()) return 0;
-
-    const State& state = it->second;
+    const State& state = def->states[currentState];
     if (currentIndex >= 0 && currentIndex < static_cast<int>(state.frames.size()))
     {
         return state.frames[currentIndex];
@@ -292,6 +344,8 @@ void StateMachineAnim::reset()
     timeAccumulator = 0.0f;
     stateComplete = false;
     // Note: does not change current state, just resets its animation
+    if (currentState >= 0)
+        loopsRemaining = def->states[currentState].loops;
 }
 
 // ============================================================================
@@ -300,18 +354,10 @@ void StateMachineAnim::reset()
 
 std::unique_ptr<IAnimController> FrameSequenceAnim::clone() const
 {
-    if (usePerFrameDurations)
-    {
-        auto copy = std::make_unique<FrameSequenceAnim>(frames, frameDurations, loops);
-        copy->onComplete = onComplete;  // Copy callback
-        return copy;
-    }
-    else
-    {
-        auto copy = std::make_unique<FrameSequenceAnim>(frames, defaultDuration, loops);
-        copy->onComplete = onComplete;  // Copy callback
-        return copy;
-    }
+    // Shares the frame sequence; playback starts from the beginning
+    auto copy = std::make_unique<FrameSequenceAnim>(*this);
+    copy->reset();
+    return copy;
 }
 
 std::unique_ptr<IAnimController> ToggleAnim::clone() const
@@ -321,9 +367,11 @@ std::unique_ptr<IAnimController> ToggleAnim::clone() const
 
 std::unique_ptr<IAnimController> StateMachineAnim::clone() const
 {
+    // Shares the state table; playback restarts in the current state
     auto copy = std::make_unique<StateMachineAnim>();
-    copy->states = states;  // Copy all states
-    copy->currentStateName = currentStateName;
+    copy->def = def;
+    copy->currentState = currentState;
+    copy->loopsRemaining = loopsRemaining;
     copy->onStateComplete = onStateComplete;  // Copy callback
     return copy;
 }
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include <unordered_map>
 #include <functional>
 
@@ -59,6 +60,9 @@ public:
  * - Loop count control (0 = infinite, 1 = play once, 2+ = repeat N times)
  * - Completion callback
  *
+ * The frame sequence is immutable and shared between clones; each instance
+ * only holds its playback position, so clone() does not copy the frames.
+ *
  * Example:
  *   // Walk animation: frames 0-4, 10ms per frame, infinite loop
  *   FrameSequenceAnim walkAnim({0, 1, 2, 3, 4}, 10, 0);
@@ -69,15 +73,21 @@ public:
 class FrameSequenceAnim : public IAnimController
 {
 private:
-    std::vector<int> frames;           // Frame indices to play
-    std::vector<int> frameDurations;   // Duration in milliseconds for each frame (if per-frame)
+    /// Immutable frame data shared by all clones
+    struct Sequence
+    {
+        std::vector<int> frames;           // Frame indices to play
+        std::vector<int> frameDurations;   // Duration in milliseconds for each frame (if per-frame)
+        bool usePerFrameDurations = false; // Whether to use per-frame durations
+    };
+
+    std::shared_ptr<const Sequence> sequence;
     int currentIndex = 0;              // Index into frames vector
     int defaultDuration;               // Default duration in milliseconds
     float timeAccumulator = 0.0f;      // Accumulated time in milliseconds
     int loops = 0;                     // 0 = infinite, 1 = play once, 2+ = repeat N times
     int loopsRemaining = 0;            // Remaining loops (0 when complete)
     bool complete = false;
-    bool usePerFrameDurations = false; // Whether to use per-frame durations
     std::function<void()> onComplete;
 
 public:
@@ -186,37 +196,67 @@ public:
  * Each state has its own frame sequence. Transitions are explicit via setState().
  * States can auto-transition to another state when complete.
  *
+ * The state definitions (frames, durations, transitions) are an immutable
+ * asset shared by all clones. An instance is just a playback cursor
+ * (state index, frame index, time accumulator, loops left), so clone() is
+ * a pointer copy. addState() on a shared definition copies it first.
+ *
+ * States are identified at runtime by integer StateIds. Resolve names once
+ * with findState() after loading and use the id overloads from then on;
+ * ids are stable across clones and never change once a state is added.
+ * The name-based setState()/getStateName() remain for tools and loaders.
+ *
  * Example:
  *   StateMachineAnim anim;
  *   anim.addState("flight", {0, 1, 2, 3, 4}, 9, 1, "flight_loop");  // Play once
  *   anim.addState("flight_loop", {3, 4}, 9, 0);  // Infinite loop
  *   anim.addState("impact", {5, 6}, 9, 1);  // Play once
- *   anim.setState("flight");
+ *   StateMachineAnim::StateId impact = anim.findState("impact");
+ *   anim.setState(anim.findState("flight"));
  *
  *   // When "flight" completes, it auto-transitions to "flight_loop"
- *   // Call anim.setState("impact") to trigger impact animation
+ *   // Call anim.setState(impact) to trigger impact animation
  */
 class StateMachineAnim : public IAnimController
 {
 public:
+    using StateId = int;
+    static constexpr StateId NO_STATE = -1;
+
     struct State
     {
         std::vector<int> frames;           // Frame sequence for this state
         std::vector<int> frameDurations;   // Duration in milliseconds for each frame (if per-frame)
         int defaultDuration;               // Default duration in milliseconds
         int loops;                         // 0 = infinite, 1 = play once, 2+ = repeat N times
-        int loopsRemaining;                // Remaining loops (decremented each cycle)
         bool usePerFrameDurations;         // Whether to use per-frame durations
         std::string nextState;             // Auto-transition to this state when complete (empty = stay)
+        int next = -1;                     // Index of nextState (-1 = stay)
     };
 
 private:
-    std::unordered_map<std::string, State> states;
-    std::string currentStateName;
+    /// Immutable state table shared by all clones
+    struct Definition
+    {
+        std::vector<State> states;                      // Indexed by state id
+        std::vector<std::string> names;                 // Name of each state id
+        std::unordered_map<std::string, int> ids;       // Name -> state id
+    };
+
+    std::shared_ptr<Definition> def;
+    StateId currentState = NO_STATE;
     int currentIndex = 0;
     float timeAccumulator = 0.0f;  // Accumulated time in milliseconds
+    int loopsRemaining = 0;        // Remaining loops of the current state
     bool stateComplete = false;
-    std::function<void(const std::string&)> onStateComplete;
+    std::function<void(StateId)> onStateComplete;
+
+    /**
+     * Make def safe to modify (copy it if other clones share it)
+     */
+    Definition& editDefinition();
+    void storeState(const std::string& name, State state);
+    void enterState(int id);
 
 public:
     StateMachineAnim() = default;
@@ -244,14 +284,40 @@ public:
                   int loopCount = 0, const std::string& nextState = "");
 
     /**
-     * Transition to a different state
+     * Resolve a state name to its id (resolve once at load time)
+     * @return State id, or NO_STATE if there is no such state
      */
-    void setState(const std::string& name);
+    StateId findState(const std::string& name) const;
+
+    /**
+     * Transition to a different state (ignored for NO_STATE or unknown ids)
+     */
+    void setState(StateId id);
+
+    /**
+     * Transition to a different state by name (tools and loaders)
+     */
+    void setState(const std::string& name) { setState(findState(name)); }
+
+    /**
+     * Get current state id (NO_STATE before the first setState)
+     */
+    StateId getState() const { return currentState; }
 
     /**
      * Get current state name
      */
-    const std::string& getStateName() const { return currentStateName; }
+    const std::string& getStateName() const { return getStateName(currentState); }
+
+    /**
+     * Get the name of a state id (empty for NO_STATE or unknown ids)
+     */
+    const std::string& getStateName(StateId id) const;
+
+    /**
+     * Number of states (valid ids are 0 .. getStateCount() - 1)
+     */
+    int getStateCount() const { return def ? static_cast<int>(def->states.size()) : 0; }
 
     /**
      * Check if current state has completed (non-looping states)
@@ -264,9 +330,9 @@ public:
     bool isComplete() const override { return stateComplete; }
 
     /**
-     * Callback when a non-looping state completes
+     * Callback when a non-looping state completes (receives the completed state id)
      */
-    void setOnStateComplete(std::function<void(const std::string&)> callback)
+    void setOnStateComplete(std::function<void(StateId)> callback)
     {
         onStateComplete = std::move(callback);
     }
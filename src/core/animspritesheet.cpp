@@ -30,14 +30,16 @@ AnimSpriteSheet::AnimSpriteSheet(std::unique_ptr<SpriteSheet> sheet,
 }
 
 AnimSpriteSheet::AnimSpriteSheet(SpriteSheet* shared,
-                                 std::unique_ptr<IAnimController> clonedAnim)
+                                 std::unique_ptr<IAnimController> clonedAnim,
+                                 int boxWidth, int boxHeight)
     : sharedSheet(shared)
     , ownsSheet(false)
     , animController(std::move(clonedAnim))
     , stateMachinePtr(nullptr)
 {
+    width = boxWidth;
+    height = boxHeight;
     updateStateMachineCache();
-    getBoundingBoxSize(width, height);
 }
 
 AnimSpriteSheet::~AnimSpriteSheet() = default;
@@ -170,15 +172,36 @@ bool AnimSpriteSheet::isComplete() const
 // StateMachineAnim-Specific Features
 // ============================================================================
 
-bool AnimSpriteSheet::setState(const std::string& stateName)
+StateMachineAnim::StateId AnimSpriteSheet::findState(const std::string& stateName) const
 {
     if (!stateMachinePtr)
+        return StateMachineAnim::NO_STATE;
+
+    return stateMachinePtr->findState(stateName);
+}
+
+bool AnimSpriteSheet::setState(StateMachineAnim::StateId state)
+{
+    if (!stateMachinePtr || state == StateMachineAnim::NO_STATE)
         return false;
 
-    stateMachinePtr->setState(stateName);
+    stateMachinePtr->setState(state);
     return true;
 }
 
+bool AnimSpriteSheet::setState(const std::string& stateName)
+{
+    return setState(findState(stateName));
+}
+
+StateMachineAnim::StateId AnimSpriteSheet::getState() const
+{
+    if (!stateMachinePtr)
+        return StateMachineAnim::NO_STATE;
+
+    return stateMachinePtr->getState();
+}
+
 const std::string& AnimSpriteSheet::getStateName() const
 {
     if (!stateMachinePtr)
@@ -195,7 +218,7 @@ bool AnimSpriteSheet::isStateComplete() const
     return stateMachinePtr->isStateComplete();
 }
 
-void AnimSpriteSheet::setOnStateComplete(std::function<void(const std::string&)> callback)
+void AnimSpriteSheet::setOnStateComplete(std::function<void(StateMachineAnim::StateId)> callback)
 {
     if (stateMachinePtr)
     {
@@ -219,7 +242,7 @@ std::unique_ptr<AnimSpriteSheet> AnimSpriteSheet::clone() const
     SpriteSheet* sheetPtr = ownsSheet ? ownedSheet.get() : sharedSheet;
 
     return std::unique_ptr<AnimSpriteSheet>(
-        new AnimSpriteSheet(sheetPtr, std::move(clonedAnim)));
+        new AnimSpriteSheet(sheetPtr, std::move(clonedAnim), width, height));
 }
 
 // ============================================================================
@@ -140,13 +140,32 @@ public:
      */
     bool hasStates() const { return stateMachinePtr != nullptr; }
 
+    /**
+     * Resolve a state name to its id (do this once after loading)
+     * @return State id, or StateMachineAnim::NO_STATE if not a state machine or state not found
+     */
+    StateMachineAnim::StateId findState(const std::string& stateName) const;
+
     /**
      * Transition to a different animation state
+     * @param state Id returned by findState()
+     * @return true if transition succeeded, false if not a state machine or state not found
+     */
+    bool setState(StateMachineAnim::StateId state);
+
+    /**
+     * Transition to a different animation state by name (tools and loaders)
      * @param stateName Name of the state to transition to
      * @return true if transition succeeded, false if not a state machine or state not found
      */
     bool setState(const std::string& stateName);
 
+    /**
+     * Get current state id
+     * @return Current state id, or StateMachineAnim::NO_STATE if not a state machine
+     */
+    StateMachineAnim::StateId getState() const;
+
     /**
      * Get current state name
      * @return Current state name, or empty string if not a state machine
@@ -160,9 +179,9 @@ public:
 
     /**
      * Set callback for when a non-looping state completes
-     * @param callback Function called with completed state name
+     * @param callback Function called with the completed state id
      */
-    void setOnStateComplete(std::function<void(const std::string&)> callback);
+    void setOnStateComplete(std::function<void(StateMachineAnim::StateId)> callback);
 
     int getWidth() const { return width; }
     int getHeight() const { return height; }
@@ -175,7 +194,9 @@ public:
      * Create a clone with independent animation state but shared texture
      *
      * Use case: Multiple entities (e.g., bullets) that share the same texture
-     * but need independent animation playback.
+     * but need independent animation playback. Frame sequences and state
+     * tables are shared too (see StateMachineAnim), so a clone only
+     * allocates the playback cursor.
      *
      * @return New AnimSpriteSheet with shared texture ownership
      */
@@ -246,10 +267,12 @@ private:
                     std::unique_ptr<IAnimController> anim);
 
     /**
-     * Internal constructor for shared sheet (cloning)
+     * Internal constructor for shared sheet (cloning); the bounding box is
+     * taken from the source instead of being recomputed
      */
     AnimSpriteSheet(SpriteSheet* sharedSheet,
-                    std::unique_ptr<IAnimController> clonedAnim);
+                    std::unique_ptr<IAnimController> clonedAnim,
+                    int boxWidth, int boxHeight);
 
     /**
      * Update stateMachinePtr cache after animation change
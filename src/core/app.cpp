@@ -12,8 +12,8 @@
 
 GameState::GameState()
     : msPerFrame(0), fps(0), fpsv(0), active(true), pause(false), 
-      difTime1(0), difTime2(0), time1(0), time2(0),
-      frameStatus(0), frameCount(0), frameTick(0), lastFrameTick(0)
+      accumulatedMs(0.0), lastTickCounter(0), renderAlpha(1.0f),
+      frameCount(0), frameTick(0), lastFrameTick(0)
 {		
 }
 
@@ -22,15 +22,11 @@ int GameState::init()
     active = true;
     pause = false;
     setUpdateFrameRate(60);
-    difTime1 = 0;
-    difTime2 = msPerFrame;
-    time1 = SDL_GetTicks() + msPerFrame;
-    time2 = SDL_GetTicks();
+    doPause();
     fps = 0;
     fpsv = 0;
     
-    // Initialize frame timing
-    frameStatus = 0;
+    // Initialize frame counting
     frameCount = 0;
     frameTick = 0;
     lastFrameTick = 0;
@@ -72,6 +68,16 @@ void GameState::drawDebugOverlay()
 
     textOverlay.addTextF("FPS = %d  FPSVIRT = %d", fps, fpsv);
 
+    const FramePacer& pacer = appData.pacer;
+    textOverlay.addTextF("CPU = %.0f%%  Frame = %.2f ms  Jitter = %.2f ms",
+            pacer.getCpuUsage(), pacer.getFrameTimeMs(), pacer.getJitterMs());
+
+    const RenderStats::Frame& rs = appData.graph.getRenderStats().last();
+    textOverlay.addTextF("Draw calls = %u  Switches = %u  Textures = %u  Prims = %u",
+            (unsigned)rs.drawCalls, (unsigned)rs.textureSwitches, (unsigned)rs.texturesBound,
+            (unsigned)rs.primitives);
+    textOverlay.addTextF("Overdraw = %.2fx  Flip = %.2f ms", rs.overdraw(RES_X, RES_Y), rs.flipMs);
+
     textOverlay.addTextF("Paused = %s  Active = %s",
             pause ? "YES" : "NO",
             active ? "YES" : "NO");
@@ -229,13 +235,17 @@ void GameState::releaseSharedBackground()
 
 /**
  * This function is central to the game.
- * It manages the number of times the screen is painted, up to the set maximum,
- * and calculations are performed as many times as specified (msPerFrame variable).
+ * Simulation runs at a fixed rate (msPerFrame), independent of how often
+ * the screen is painted. Real elapsed time is accumulated and consumed in
+ * whole simulation steps; whatever is left over becomes the interpolation
+ * factor (renderAlpha) used by drawAll() to place moving objects between
+ * their last two simulated positions.
  *
- * For example, if we want to render 60 frames per second using a counter,
- * we ensure that 60 calculations are performed. If time permits, we render 60 frames;
- * on slower systems, we render only as many as possible, but the "virtual" speed
- * of the game remains 60 fps.
+ * GameRunner calls this once per display refresh (via FramePacer), so on a
+ * 120/144 Hz monitor most calls only draw, while on slower systems several
+ * moveAll steps may run before the next draw (at most MAX_CATCHUP_STEPS;
+ * older time is dropped). Either way the "virtual" speed of the game
+ * remains 60 fps.
  */
 GameState* GameState::doTick(float deltaTime)
 {
@@ -248,46 +258,45 @@ GameState* GameState::doTick(float deltaTime)
         return (GameState*) new Menu;
     }
 
-    if (frameStatus == 0)
-    {
-        time1 = SDL_GetTicks();
-        difTime2 = time1 - time2;
-        if (difTime2 < msPerFrame) return nullptr;
-        time2 = time1;
-        difTime1 += difTime2;
-        frameStatus = 1;
-        return nullptr;
-    }
+    if (lastTickCounter == 0)
+        doPause();
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    accumulatedMs += (double)(now - lastTickCounter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    lastTickCounter = now;
+
+    // After a long stall (window drag, breakpoint, slow load) don't try to
+    // catch up on all of it: that spiral only makes the next frame slower.
+    // The excess is dropped, so the game briefly runs slower than real time.
+    double maxAccumulatedMs = (double)msPerFrame * MAX_CATCHUP_STEPS;
+    if (accumulatedMs > maxAccumulatedMs)
+        accumulatedMs = maxAccumulatedMs;
 
-    if (frameStatus == 1)
+    // Pass fixed timestep based on msPerFrame (milliseconds per frame)
+    // Convert msPerFrame to seconds for consistent simulation
+    float fixedDeltaTime = msPerFrame / 1000.0f;
+    while (accumulatedMs >= msPerFrame)
     {
-        if (difTime1 < msPerFrame)
-        {
-            frameStatus = 2;
-            return nullptr;
-        }
-        // Pass fixed timestep based on msPerFrame (milliseconds per frame)
-        // Convert msPerFrame to seconds for consistent simulation
-        float fixedDeltaTime = msPerFrame / 1000.0f;
+        storePrevPositions();
         GameState* newscreen = moveAll(fixedDeltaTime);
-        difTime1 -= msPerFrame;
-        return newscreen;
+        accumulatedMs -= msPerFrame;
+        if (newscreen)
+            return newscreen;
     }
 
-    if (frameStatus == 2)
+    renderAlpha = (float)(accumulatedMs / msPerFrame);
+    if (renderAlpha > 1.0f) renderAlpha = 1.0f;
+
+    drawAll();
+    frameTick = SDL_GetTicks();
+    if (frameTick - lastFrameTick > 1000)
     {
-        drawAll();
-        frameStatus = 0;
-        frameTick = SDL_GetTicks();
-        if (frameTick - lastFrameTick > 1000)
-        {
-            fps = frameCount;
-            frameCount = 0;
-            lastFrameTick = frameTick;
-        }
-        else
-            frameCount++;
+        fps = frameCount;
+        frameCount = 0;
+        lastFrameTick = frameTick;
     }
+    else
+        frameCount++;
 
     return nullptr;
 }
@@ -295,13 +304,15 @@ GameState* GameState::doTick(float deltaTime)
 /**
  * If we pause, we need to update these data points so that the 
  * doTick function behaves correctly once the game is resumed.
+ *
+ * The accumulator restarts at half a frame so that pacer wake-up jitter
+ * (fractions of a millisecond) never straddles the step threshold, which
+ * would otherwise alternate between zero and two moveAll calls per frame.
  */
 void GameState::doPause()
 {	
-    difTime1 = 0; 
-    difTime2 = msPerFrame;
-    time1 = SDL_GetTicks() + msPerFrame;
-    time2 = SDL_GetTicks();
+    accumulatedMs = msPerFrame * 0.5;
+    lastTickCounter = SDL_GetPerformanceCounter();
 }
 
 /**
@@ -310,7 +321,7 @@ void GameState::doPause()
  */
 void GameState::setUpdateFrameRate(int speed)
 {
-    msPerFrame = 1000 / speed;
+    msPerFrame = 1000.0f / speed;
 }
 
 void GameState::setActive(bool b)
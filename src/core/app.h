@@ -33,11 +33,14 @@ protected:
     int fps, fpsv; // stats for frames per second and virtual fps
     bool active; // window active?
     bool pause;
-    int difTime1, difTime2;
-    long time1, time2;
-    
-    // Frame timing variables (previously static in doTick)
-    int frameStatus;
+
+    // Fixed-step timing (driven by the FramePacer in GameRunner)
+    static constexpr int MAX_CATCHUP_STEPS = 5;  // Most moveAll steps run by one doTick
+    double accumulatedMs;    // Real time not yet consumed by moveAll steps
+    Uint64 lastTickCounter;  // Performance counter at the previous doTick
+    float renderAlpha;       // Interpolation factor for drawAll [0,1] between last two sim states
+
+    // Frame counting for the FPS display
     int frameCount;
     long frameTick;
     long lastFrameTick;
@@ -73,6 +76,9 @@ public:
     virtual int init();
     virtual GameState* moveAll(float dt) = 0;
     virtual int drawAll() = 0;
+
+    // Called before each fixed simulation step so drawAll() can interpolate positions
+    virtual void storePrevPositions() {}
     virtual int release() = 0;
     
     // Final render step - called after drawAll() to add overlays and flip
@@ -77,8 +77,8 @@ const char* Keys::getKeyName(SDL_Scancode scancode)
 
 
 AppData::AppData()
-    : numPlayers(1), numStages(0), currentStage(1), inMenu(true),
-      activeScene(nullptr), sharedBackground(nullptr), scrollX(0.0f),
+    : numPlayers(1), numStages(0), useAtlas(true), currentStage(1), inMenu(true),
+      activeScene(nullptr), gameSeed(0), sharedBackground(nullptr), scrollX(0.0f),
       scrollY(0.0f), backgroundInitialized(false), debugMode(false),
       quit(false), goBack(false), renderMode(RENDERMODE_NORMAL),
       currentScreen(nullptr), nextScreen(nullptr)
@@ -275,9 +275,67 @@ void AppData::initStageResources()
     stageRes.hexaSplashAnim[2] = AnimSpriteSheet::load(&appGraph, HEXA_SPLASH_JSON, "assets/graph/entities/hexagon_splash_orange.png");
     stageRes.hexaSplashAnim[3] = AnimSpriteSheet::load(&appGraph, HEXA_SPLASH_JSON, "assets/graph/entities/hexagon_splash_purple.png");
 
+    // Nothing is drawn headless, so there is nothing to gain from packing
+    if (useAtlas && !appGraph.isHeadless())
+        buildAtlas();
+
     stageRes.initialized = true;
 }
 
+/**
+ * @brief Packs the shared stage sprites into a few atlas pages
+ *
+ * Every sprite and sprite sheet loaded by initStageResources() (entities,
+ * weapons, effects, pickups, HUD, number fonts, player poses) is moved into
+ * the atlas, so a frame draws from a handful of textures instead of one
+ * per sprite. Per-player animations are loaded later and keep their own
+ * textures.
+ */
+void AppData::buildAtlas()
+{
+    auto addSheet = [this](const std::unique_ptr<AnimSpriteSheet>& anim)
+    {
+        if (anim)
+            atlas.add(anim->getSpriteSheet());
+    };
+
+    for (const auto& anim : stageRes.ballAnim) addSheet(anim);
+    for (const auto& anim : stageRes.ballSplashAnim) addSheet(anim);
+    for (const auto& anim : stageRes.floorAnim) addSheet(anim);
+    for (const auto& anim : stageRes.glassAnim) addSheet(anim);
+    for (const auto& anim : stageRes.hexaAnim) addSheet(anim);
+    for (const auto& anim : stageRes.hexaSplashAnim) addSheet(anim);
+    addSheet(stageRes.gunBulletAnim);
+    addSheet(stageRes.clawWeaponAnim);
+    addSheet(stageRes.clawWeaponYellowAnim);
+    addSheet(stageRes.gunSparkAnim);
+    addSheet(stageRes.harpoonSparkAnim);
+    addSheet(stageRes.pickupShieldAnim);
+    addSheet(stageRes.shieldAnim);
+    atlas.add(&stageRes.harpoonChain);
+
+    atlas.add(&stageRes.ladder);
+    atlas.add(&stageRes.harpoonTip);
+    for (Sprite& spr : stageRes.mark) atlas.add(&spr);
+    for (Sprite& spr : stageRes.miniplayer) atlas.add(&spr);
+    for (Sprite& spr : stageRes.lives) atlas.add(&spr);
+    atlas.add(&stageRes.time);
+    atlas.add(&stageRes.gameover);
+    atlas.add(&stageRes.continu);
+    atlas.add(&stageRes.ready);
+    for (Sprite& spr : stageRes.fontnum) atlas.add(&spr);
+    for (Sprite& spr : stageRes.pickupSprites) atlas.add(&spr);
+    atlas.add(&stageRes.itemHolder);
+
+    for (auto& frames : bitmaps.player)
+    {
+        for (Sprite& spr : frames)
+            atlas.add(&spr);
+    }
+
+    atlas.build(&appGraph);
+}
+
 void AppData::initStages()
 {
     stages.clear();
@@ -341,6 +399,9 @@ void AppData::release()
         for (int i = 0; i < 6; i++)
             stageRes.pickupSprites[i].release();
 
+        // Sprites above only referenced the pages if they were packed
+        atlas.release();
+
         stageRes.initialized = false;
     }
     
@@ -6,9 +6,12 @@
 #include "sprite.h"
 #include "graph.h"
 #include "minput.h"
+#include "framepacer.h"
+#include "replay.h"
 #include "configdata.h"
 #include "oncehelper.h"
 #include "stageresources.h"
+#include "textureatlas.h"
 
 // Forward declarations
 class Player;
@@ -105,6 +108,8 @@ public:
     Graph graph;
     MInput input;
     ConfigData config;
+    FramePacer pacer;    ///< Main loop frame scheduler (sleeps between frames)
+    Replay replay;       ///< Gameplay input recorder / player (--record, --replay)
 
     // Game session data (from GameInfo)
     int numPlayers;
@@ -113,10 +118,13 @@ public:
     Keys playerKeys[2];
     GameBitmaps bitmaps;
     StageResources stageRes;  ///< Shared stage resources (loaded once)
+    TextureAtlas atlas;       ///< Pages holding the stage resource sprites (see buildAtlas())
+    bool useAtlas;            ///< Pack stage resources into the atlas (--no-atlas disables)
     int currentStage;
     std::vector<Stage> stages;
     bool inMenu;
     GameState* activeScene;
+    Uint32 gameSeed;     ///< Base seed for gameplay randomness (--seed, /seed); each Scene derives its own stream
 
     // Shared background resources (moved from GameState statics)
     std::unique_ptr<Sprite> sharedBackground;
@@ -136,6 +144,7 @@ public:
     void init();
     void initStages();
     void initStageResources();  ///< Load shared stage sprites once
+    void buildAtlas();          ///< Pack the loaded stage sprites into the texture atlas
     void setCurrent(GameState* state);
     void release();
     
@@ -13,7 +13,7 @@ static bool fileExists(const char* filename)
 }
 
 AudioManager::AudioManager()
-    : currentMusic(nullptr), currentTrack(""), isInitialized(false)
+    : currentMusic(nullptr), currentTrack(""), isInitialized(false), headless(false)
 {
 }
 
@@ -45,6 +45,9 @@ bool AudioManager::init()
 {
     if (isInitialized)
         return true;
+
+    if (headless)
+        return false;
     
     LOG_INFO("Initializing SDL_mixer...");
     
@@ -38,6 +38,7 @@ private:
     Mix_Music* currentMusic;                          ///< Currently playing music track
     std::string currentTrack;                         ///< Filename of current track
     bool isInitialized;                               ///< SDL_mixer initialization state
+    bool headless;                                    ///< No audio device: all operations are no-ops
 
     /**
      * @brief Resolves a track ID or filepath to actual filepath
@@ -85,6 +86,14 @@ public:
      */
     bool init();
 
+    /**
+     * @brief Enables headless mode (no audio device)
+     * @note Must be called before init(). In headless mode the device is never
+     *       opened, so every load/play call fails silently and does nothing.
+     */
+    void setHeadless(bool enabled) { headless = enabled; }
+    bool isHeadless() const { return headless; }
+
     /**
      * @brief Registers a music track with an ID for easy access
      * @param id Short identifier for the track (e.g., "bgm_level1")
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <SDL.h>
+
+/**
+ * @struct EntityHandle
+ * @brief Stable reference to an object stored in an EntityPool
+ *
+ * A handle stays valid until its object is erased. After that, get()
+ * returns nullptr even if the slot has been reused by a newer object,
+ * because every reuse bumps the slot's generation.
+ */
+struct EntityHandle
+{
+    static constexpr Uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+    Uint32 index = INVALID_INDEX;   ///< Slot index in the pool
+    Uint32 generation = 0;          ///< Slot generation when the handle was issued
+
+    bool isValid() const { return index != INVALID_INDEX; }
+    bool operator==(const EntityHandle& o) const { return index == o.index && generation == o.generation; }
+    bool operator!=(const EntityHandle& o) const { return !(*this == o); }
+};
+
+/**
+ * EntityPool class
+ *
+ * Generational slot map owning the objects of one entity type.
+ *
+ * Objects are constructed in place in fixed-size chunks of CHUNK_SIZE
+ * slots, so spawning an object does not allocate once the pool has grown
+ * to its working size, and object addresses never change while alive.
+ *
+ * Live objects are listed in a dense array that is iterated in order
+ * (for (T* obj : pool)). Erasing swaps the last element into the hole
+ * ("swap-and-pop"), so erasure is O(1) but changes iteration order.
+ *
+ * SlotSize/SlotAlign allow pools of a polymorphic base class (e.g. Shot)
+ * that hold any subclass fitting in a slot; see emplace<U>(). They default
+ * to the size and alignment of T, so EntityPool<T>& can be named while T
+ * is still incomplete.
+ *
+ * Adding objects while iterating the same pool with a range-for is not
+ * allowed (the dense array may grow). Index loops over size() are fine.
+ */
+template<typename T, size_t SlotSize = 0, size_t SlotAlign = 0>
+class EntityPool
+{
+public:
+    static constexpr Uint32 CHUNK_SIZE = 64;
+    static constexpr size_t SLOT_SIZE = SlotSize ? SlotSize : sizeof(T);     ///< 0 = sizeof(T)
+    static constexpr size_t SLOT_ALIGN = SlotAlign ? SlotAlign : alignof(T); ///< 0 = alignof(T)
+
+    using iterator = typename std::vector<T*>::const_iterator;
+
+    EntityPool() = default;
+    ~EntityPool() { clear(); }
+
+    EntityPool(const EntityPool&) = delete;
+    EntityPool& operator=(const EntityPool&) = delete;
+
+    /**
+     * @brief Construct an object in a free slot
+     * @tparam U T or a subclass of T that fits in a slot
+     * @return Pointer to the new object (stable until erased)
+     */
+    template<typename U = T, typename... Args>
+    U* emplace(Args&&... args)
+    {
+        static_assert(std::is_base_of<T, U>::value, "EntityPool: U must derive from T");
+        static_assert(sizeof(U) <= SLOT_SIZE && alignof(U) <= SLOT_ALIGN, "EntityPool: U does not fit in a slot");
+
+        Uint32 slot = acquireSlot();
+        U* obj = new (slotMemory(slot)) U(std::forward<Args>(args)...);
+        commit(slot, obj);
+        return obj;
+    }
+
+    /**
+     * @brief Construct an object through a callback
+     *
+     * For copies whose dynamic type is only known to the source object:
+     * construct(void* memory) must placement-new the object into memory
+     * (SLOT_SIZE bytes) and return it.
+     */
+    template<typename F>
+    T* emplaceWith(F&& construct)
+    {
+        Uint32 slot = acquireSlot();
+        T* obj = construct(slotMemory(slot));
+        commit(slot, obj);
+        return obj;
+    }
+
+    /**
+     * @brief Destroy the object at a dense index (swap-and-pop)
+     *
+     * The last object takes its place, so a loop erasing at index i must
+     * not advance i.
+     */
+    void erase(size_t i)
+    {
+        Uint32 slot = denseSlot[i];
+        dense[i]->~T();
+
+        Uint32 last = (Uint32)dense.size() - 1;
+        if (i != last)
+        {
+            dense[i] = dense[last];
+            denseSlot[i] = denseSlot[last];
+            slotDense[denseSlot[i]] = (Uint32)i;
+        }
+        dense.pop_back();
+        denseSlot.pop_back();
+
+        slotDense[slot] = EntityHandle::INVALID_INDEX;
+        generations[slot]++;
+        freeSlots.push_back(slot);
+    }
+
+    /**
+     * @brief Erase every object matching pred (swap-and-pop compaction)
+     * @return Number of objects erased
+     */
+    template<typename Pred>
+    size_t removeIf(Pred pred)
+    {
+        size_t removed = 0;
+        for (size_t i = 0; i < dense.size(); )
+        {
+            if (pred(dense[i]))
+            {
+                erase(i);
+                removed++;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Destroy all objects. Chunks are kept for reuse.
+     */
+    void clear()
+    {
+        while (!dense.empty())
+            erase(dense.size() - 1);
+    }
+
+    /**
+     * @brief Resolve a handle
+     * @return The object, or nullptr if it has been erased
+     */
+    T* get(EntityHandle h) const
+    {
+        if (h.index >= generations.size() || generations[h.index] != h.generation)
+            return nullptr;
+        Uint32 i = slotDense[h.index];
+        return i != EntityHandle::INVALID_INDEX ? dense[i] : nullptr;
+    }
+
+    /**
+     * @brief Handle of the object at a dense index
+     */
+    EntityHandle handleAt(size_t i) const
+    {
+        EntityHandle h;
+        h.index = denseSlot[i];
+        h.generation = generations[h.index];
+        return h;
+    }
+
+    T* operator[](size_t i) const { return dense[i]; }
+    T* back() const { return dense.back(); }
+
+    size_t size() const { return dense.size(); }
+    bool empty() const { return dense.empty(); }
+    size_t capacity() const { return chunks.size() * CHUNK_SIZE; }
+
+    iterator begin() const { return dense.begin(); }
+    iterator end() const { return dense.end(); }
+
+private:
+    using Storage = typename std::aligned_storage<SLOT_SIZE, SLOT_ALIGN>::type;
+
+    std::vector<std::unique_ptr<Storage[]>> chunks;  ///< Slot storage (never moves)
+    std::vector<Uint32> generations;    ///< Per slot: bumped on every erase
+    std::vector<Uint32> slotDense;      ///< Per slot: index in dense (INVALID_INDEX if free)
+    std::vector<Uint32> freeSlots;      ///< Free slot stack (most recently freed reused first)
+    std::vector<T*> dense;              ///< Live objects in iteration order
+    std::vector<Uint32> denseSlot;      ///< Per dense entry: its slot
+
+    void* slotMemory(Uint32 slot)
+    {
+        return &chunks[slot / CHUNK_SIZE][slot % CHUNK_SIZE];
+    }
+
+    Uint32 acquireSlot()
+    {
+        if (freeSlots.empty())
+        {
+            Uint32 base = (Uint32)chunks.size() * CHUNK_SIZE;
+            chunks.emplace_back(new Storage[CHUNK_SIZE]);
+            generations.resize(base + CHUNK_SIZE, 0);
+            slotDense.resize(base + CHUNK_SIZE, (Uint32)EntityHandle::INVALID_INDEX);
+
+            // Push in reverse so slots are handed out in ascending order
+            for (Uint32 s = CHUNK_SIZE; s > 0; s--)
+                freeSlots.push_back(base + s - 1);
+        }
+
+        Uint32 slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+
+    void commit(Uint32 slot, T* obj)
+    {
+        slotDense[slot] = (Uint32)dense.size();
+        dense.push_back(obj);
+        denseSlot.push_back(slot);
+    }
+};
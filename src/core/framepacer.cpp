@@ -0,0 +1,85 @@
+#include "framepacer.h"
+#include <cmath>
+
+FramePacer::FramePacer()
+    : ticksPerMs(1.0), periodMs(1000.0 / 60.0), nextDeadline(0), lastFrameStart(0),
+      windowMs(0.0), windowSleepMs(0.0), sumIntervalMs(0.0), sumIntervalSqMs(0.0), intervalCount(0),
+      cpuUsage(0.0f), frameTimeMs(0.0f), jitterMs(0.0f)
+{
+}
+
+void FramePacer::setTargetFrameTime(double ms)
+{
+    if (ms <= 0.0 || ms == periodMs)
+        return;
+
+    periodMs = ms;
+    reset();
+}
+
+void FramePacer::reset()
+{
+    ticksPerMs = (double)SDL_GetPerformanceFrequency() / 1000.0;
+    Uint64 now = SDL_GetPerformanceCounter();
+    nextDeadline = now + (Uint64)(periodMs * ticksPerMs);
+    lastFrameStart = now;
+}
+
+void FramePacer::waitForNextFrame()
+{
+    if (nextDeadline == 0)
+        reset();
+
+    Uint64 waitStart = SDL_GetPerformanceCounter();
+    double sleptMs = 0.0;
+
+    // Coarse phase: hand most of the remaining budget back to the OS
+    if (nextDeadline > waitStart)
+    {
+        double remainingMs = toMs(nextDeadline - waitStart);
+        if (remainingMs > SPIN_MARGIN_MS)
+        {
+            SDL_Delay((Uint32)(remainingMs - SPIN_MARGIN_MS));
+            sleptMs = toMs(SDL_GetPerformanceCounter() - waitStart);
+        }
+    }
+
+    // Fine phase: spin the last sub-millisecond
+    Uint64 now = SDL_GetPerformanceCounter();
+    while (now < nextDeadline)
+        now = SDL_GetPerformanceCounter();
+
+    // Advance by a fixed period to avoid drift; resync if more than a frame late
+    Uint64 periodTicks = (Uint64)(periodMs * ticksPerMs);
+    nextDeadline += periodTicks;
+    if (now > nextDeadline)
+        nextDeadline = now + periodTicks;
+
+    recordFrame(toMs(now - lastFrameStart), sleptMs);
+    lastFrameStart = now;
+}
+
+void FramePacer::recordFrame(double intervalMs, double sleptMs)
+{
+    windowMs += intervalMs;
+    windowSleepMs += sleptMs;
+    sumIntervalMs += intervalMs;
+    sumIntervalSqMs += intervalMs * intervalMs;
+    intervalCount++;
+
+    if (windowMs < STATS_WINDOW_MS)
+        return;
+
+    double mean = sumIntervalMs / intervalCount;
+    double variance = sumIntervalSqMs / intervalCount - mean * mean;
+
+    cpuUsage = (float)(100.0 * (1.0 - windowSleepMs / windowMs));
+    frameTimeMs = (float)mean;
+    jitterMs = (float)std::sqrt(variance > 0.0 ? variance : 0.0);
+
+    windowMs = 0.0;
+    windowSleepMs = 0.0;
+    sumIntervalMs = 0.0;
+    sumIntervalSqMs = 0.0;
+    intervalCount = 0;
+}
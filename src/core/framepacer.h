@@ -0,0 +1,75 @@
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * FramePacer - Sleeps the main loop until the next frame deadline.
+ *
+ * Uses SDL_GetPerformanceCounter for timing. Most of the remaining frame
+ * budget is given back to the OS with SDL_Delay; only the final stretch
+ * (below SPIN_MARGIN_MS) is spin-waited to hit the deadline precisely.
+ *
+ * Deadlines advance by a fixed period, so small oversleeps don't accumulate
+ * drift. If the loop falls more than a full frame behind (loading, debugger),
+ * the schedule is resynchronised to "now" instead of bursting to catch up.
+ *
+ * Also measures, over one-second windows:
+ * - CPU utilisation: share of wall time not spent sleeping (work + spin)
+ * - Frame time and jitter: mean and standard deviation of frame intervals
+ *
+ * Usage:
+ *   pacer.setTargetFrameTime(1000.0 / 60.0);
+ *   while (running) { update(); render(); pacer.waitForNextFrame(); }
+ */
+class FramePacer
+{
+private:
+    static constexpr double SPIN_MARGIN_MS = 1.0;     // Spin-wait below this much remaining time
+    static constexpr double STATS_WINDOW_MS = 1000.0; // Statistics refresh period
+
+    double ticksPerMs;       // Performance counter ticks per millisecond
+    double periodMs;         // Target frame period
+    Uint64 nextDeadline;     // Counter value of the next frame deadline
+    Uint64 lastFrameStart;   // Counter value when the previous wait returned
+
+    // Statistics accumulators for the current window
+    double windowMs;
+    double windowSleepMs;
+    double sumIntervalMs;
+    double sumIntervalSqMs;
+    int intervalCount;
+
+    // Published statistics (last complete window)
+    float cpuUsage;          // Percent (0-100)
+    float frameTimeMs;       // Mean frame interval
+    float jitterMs;          // Standard deviation of frame interval
+
+public:
+    FramePacer();
+
+    /**
+     * Set the target frame period in milliseconds
+     * Restarts the schedule if the period changes.
+     */
+    void setTargetFrameTime(double ms);
+    double getTargetFrameTime() const { return periodMs; }
+
+    /**
+     * Restart the schedule from the current time
+     * Call after long stalls (pause, screen transitions).
+     */
+    void reset();
+
+    /**
+     * Block until the next frame deadline (sleep, then spin the remainder)
+     */
+    void waitForNextFrame();
+
+    float getCpuUsage() const { return cpuUsage; }
+    float getFrameTimeMs() const { return frameTimeMs; }
+    float getJitterMs() const { return jitterMs; }
+
+private:
+    double toMs(Uint64 ticks) const { return (double)ticks / ticksPerMs; }
+    void recordFrame(double intervalMs, double sleptMs);
+};
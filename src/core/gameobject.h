@@ -19,6 +19,12 @@ protected:
     float yPos = 0.0f;
     float xInit = 0.0f;  // Initial spawn X position
     float yInit = 0.0f;  // Initial spawn Y position
+    float xPrev = 0.0f;  // Position before the last simulation step (for interpolation)
+    float yPrev = 0.0f;
+    bool hasPrev = false;
+    float xStep = 0.0f;  // Position at the start of the last movement update (for swept collision)
+    float yStep = 0.0f;
+    bool hasStep = false;
 
     /**
      * Reset the dead flag. Used by entities that can revive (e.g., Player).
@@ -41,6 +47,35 @@ public:
     float getInitY() const { return yInit; }
     void setInitPos(float x, float y) { xInit = x; yInit = y; }
     void resetToInitPos() { xPos = xInit; yPos = yInit; }
+
+    /**
+     * Remember the current position as the start of the next simulation step
+     * for render interpolation. Called once per fixed step, before moveAll().
+     */
+    void storePrevPos() { xPrev = getX(); yPrev = getY(); hasPrev = true; }
+
+    /**
+     * Position for rendering, interpolated between the last two simulation steps.
+     * @param alpha Fraction of the next step already elapsed [0,1]
+     */
+    float getRenderX(float alpha) const { return hasPrev ? xPrev + (getX() - xPrev) * alpha : getX(); }
+    float getRenderY(float alpha) const { return hasPrev ? yPrev + (getY() - yPrev) * alpha : getY(); }
+
+    /**
+     * Remember the current position as the start of the movement update.
+     * Called by Scene::updateEntities() right before the object moves, so
+     * collision detection in the next step sees the path it has not checked yet.
+     * Independent of storePrevPos(), which belongs to rendering.
+     */
+    void storeStepStart() { xStep = getX(); yStep = getY(); hasStep = true; }
+
+    /**
+     * Position at the start of the last movement update (see storeStepStart()).
+     * Used by swept collision to reconstruct the path of the step.
+     */
+    bool hasStepStart() const { return hasStep; }
+    float getStepStartX() const { return xStep; }
+    float getStepStartY() const { return yStep; }
     
     /**
      * Check if this object should be removed from the game world.
@@ -8,13 +8,90 @@
 #include "appconsole.h"
 #include "eventmanager.h"
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 
 GameRunner::GameRunner()
-    : appData(AppData::instance()), isInitialized(false), lastFrameTime(0), deltaTime(0.0f)
+    : appData(AppData::instance()), isInitialized(false), lastFrameTime(0), deltaTime(0.0f),
+      headless(false), headlessStage(1), headlessTicks(3600), hasSeed(false),
+      hasTicks(false), directPlayers(1)
 {
 }
 
+bool GameRunner::parseArguments(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (std::strcmp(arg, "--headless") == 0)
+        {
+            headless = true;
+        }
+        else if (std::strcmp(arg, "--stage") == 0 && hasValue)
+        {
+            headlessStage = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(arg, "--ticks") == 0 && hasValue)
+        {
+            headlessTicks = std::atoi(argv[++i]);
+            hasTicks = true;
+        }
+        else if (std::strcmp(arg, "--seed") == 0 && hasValue)
+        {
+            appData.gameSeed = (Uint32)std::strtoul(argv[++i], nullptr, 10);
+            hasSeed = true;
+        }
+        else if (std::strcmp(arg, "--no-atlas") == 0)
+        {
+            appData.useAtlas = false;
+        }
+        else if (std::strcmp(arg, "--render-csv") == 0 && hasValue)
+        {
+            renderCsvPath = argv[++i];
+        }
+        else if (std::strcmp(arg, "--record") == 0 && hasValue)
+        {
+            appData.replay.armRecording(argv[++i]);
+        }
+        else if (std::strcmp(arg, "--record-hashes") == 0)
+        {
+            appData.replay.setRecordHashes(true);
+        }
+        else if (std::strcmp(arg, "--replay") == 0 && hasValue)
+        {
+            if (!appData.replay.loadPlayback(argv[++i]))
+                return false;
+        }
+        else
+        {
+            LOG_ERROR("Unknown or incomplete argument: %s", arg);
+            LOG_INFO("Usage: boing [--headless] [--stage N] [--ticks N] [--seed N] [--no-atlas] [--render-csv FILE] [--record FILE [--record-hashes]] [--replay FILE]");
+            return false;
+        }
+    }
+
+    if (headlessStage < 1 || headlessTicks < 1)
+    {
+        LOG_ERROR("--stage and --ticks must be positive");
+        return false;
+    }
+
+    // A replay dictates stage, seed and players; headless runs it to its end
+    if (appData.replay.isPlaying())
+    {
+        headlessStage = appData.replay.getStage();
+        directPlayers = appData.replay.getNumPlayers();
+        appData.gameSeed = appData.replay.getSeed();
+        hasSeed = true;
+        if (!hasTicks)
+            headlessTicks = appData.replay.getTickCount();
+    }
+
+    return true;
+}
+
 GameRunner::~GameRunner()
 {
     if (isInitialized)
@@ -27,9 +104,15 @@ bool GameRunner::initialize()
 {
     LOG_INFO("Initializing game...");
     
-    // Initialize random number generator with current time as seed
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    LOG_DEBUG("Random number generator initialized");
+    // Gameplay randomness is driven by per-Scene generators derived from this seed
+    if (!hasSeed)
+        appData.gameSeed = static_cast<Uint32>(std::time(nullptr));
+    LOG_INFO("Game seed: %u", appData.gameSeed);
+
+    // Headless mode: input reports no keys, audio never opens a device,
+    // and graphics renders offscreen without a window
+    appData.input.setHeadless(headless);
+    AudioManager::instance().setHeadless(headless);
 
     // Initialize input subsystem
     if (!appData.input.init())
@@ -40,12 +123,19 @@ bool GameRunner::initialize()
     LOG_SUCCESS("Input subsystem initialized");
     
     // Initialize audio subsystem (SDL_mixer)
-    if (!AudioManager::instance().init())
+    if (headless)
+    {
+        LOG_INFO("Audio disabled (headless)");
+    }
+    else if (!AudioManager::instance().init())
     {
         LOG_ERROR("Failed to initialize audio subsystem");
         return false;
     }
-    LOG_SUCCESS("Audio subsystem initialized");
+    else
+    {
+        LOG_SUCCESS("Audio subsystem initialized");
+    }
 
     // Initialize EventManager (singleton - auto-creates on first access)
     EventManager::instance();
@@ -64,7 +154,9 @@ bool GameRunner::initialize()
     LOG_DEBUG("Configuration loaded");
 
     // Initialize graphics subsystem
-    if (!appData.graph.init("Hyper Boing", appData.renderMode))
+    int graphOk = headless ? appData.graph.initHeadless()
+                           : appData.graph.init("Hyper Boing", appData.renderMode);
+    if (!graphOk)
     {
         LOG_ERROR("Failed to initialize graphics subsystem");
         return false;
@@ -81,10 +173,18 @@ bool GameRunner::initialize()
     appData.initStageResources();
     LOG_DEBUG("Stage resources initialized");
     
-    // Create and initialize first screen (Menu)
-    appData.currentScreen = std::make_unique<Menu>();
-    appData.currentScreen->init();
-    LOG_DEBUG("Menu screen created");
+    if (headless || appData.replay.isPlaying())
+    {
+        if (!startStageDirect())
+            return false;
+    }
+    else
+    {
+        // Create and initialize first screen (Menu)
+        appData.currentScreen = std::make_unique<Menu>();
+        appData.currentScreen->init();
+        LOG_DEBUG("Menu screen created");
+    }
     
     isInitialized = true;
     LOG_SUCCESS("Initialization complete!");
@@ -263,7 +363,19 @@ void GameRunner::handleStateTransition()
 void GameRunner::shutdown()
 {
     LOG_INFO("Shutting down...");
+
+    // Flush a recording still in progress
+    appData.replay.stop();
     
+    // Dump the render stats history (last RenderStats::HISTORY_FRAMES frames)
+    if (!renderCsvPath.empty())
+    {
+        if (appData.graph.getRenderStats().writeCsv(renderCsvPath, RES_X, RES_Y))
+            LOG_INFO("Render stats written to %s", renderCsvPath.c_str());
+        else
+            LOG_ERROR("Could not write render stats to %s", renderCsvPath.c_str());
+    }
+
     // Save configuration
     appData.config.save();
     LOG_DEBUG("Configuration saved");
@@ -289,6 +401,92 @@ void GameRunner::shutdown()
     LOG_SUCCESS("Shutdown complete");
 }
 
+bool GameRunner::startStageDirect()
+{
+    // Skip menus: start a fresh game directly on the requested stage
+    appData.player[AppData::PLAYER1] = std::make_unique<Player>(AppData::PLAYER1);
+    if (directPlayers > 1)
+        appData.player[AppData::PLAYER2] = std::make_unique<Player>(AppData::PLAYER2);
+
+    appData.initStages();
+    if (headlessStage > appData.getNumStages())
+    {
+        LOG_ERROR("Stage %d is out of range (1-%d)", headlessStage, appData.getNumStages());
+        return false;
+    }
+
+    appData.getCurrentStage() = headlessStage;
+    appData.currentScreen = std::make_unique<Scene>(&appData.getStages()[headlessStage - 1]);
+    appData.setCurrent(appData.currentScreen.get());
+    appData.currentScreen->init();
+    LOG_DEBUG("Scene created directly (stage %d, %d player(s))", headlessStage, directPlayers);
+    return true;
+}
+
+int GameRunner::runHeadless()
+{
+    LOG_INFO("Headless simulation: stage %d, %d ticks", headlessStage, headlessTicks);
+
+    // Same expression as GameState::doTick, so headless and windowed runs
+    // (and replays recorded in either) step with a bit-identical dt
+    const float msPerFrame = 1000.0f / GameState::GLOBAL_UPDATE_FRAMERATE;
+    const float fixedDeltaTime = msPerFrame / 1000.0f;
+    const double ticksPerMs = (double)SDL_GetPerformanceFrequency() / 1000.0;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    Uint64 lastReport = start;
+    int lastReportTick = 0;
+    int tick = 0;
+
+    for (; tick < headlessTicks && !appData.quit; tick++)
+    {
+        // Only a Scene can be simulated; menus mean the game is over
+        if (!dynamic_cast<Scene*>(appData.currentScreen.get()))
+        {
+            LOG_INFO("Simulation left gameplay after %d ticks", tick);
+            break;
+        }
+
+        GameState* newScreen = appData.currentScreen->moveAll(fixedDeltaTime);
+        if (newScreen != nullptr)
+        {
+            appData.nextScreen.reset(newScreen);
+            handleStateTransition();
+        }
+
+        // Honour Ctrl+C (SDL turns SIGINT into SDL_QUIT) and report once per second
+        Uint64 now = SDL_GetPerformanceCounter();
+        double sinceReportMs = (double)(now - lastReport) / ticksPerMs;
+        if (sinceReportMs >= 1000.0)
+        {
+            SDL_Event e;
+            while (SDL_PollEvent(&e))
+            {
+                if (e.type == SDL_QUIT)
+                    appData.quit = true;
+            }
+
+            LOG_INFO("  tick %d: %.0f ticks/s (stage %d)", tick,
+                     (tick - lastReportTick) * 1000.0 / sinceReportMs, appData.getCurrentStage());
+            lastReport = now;
+            lastReportTick = tick;
+        }
+    }
+
+    double elapsedMs = (double)(SDL_GetPerformanceCounter() - start) / ticksPerMs;
+    double ticksPerSecond = elapsedMs > 0.0 ? tick * 1000.0 / elapsedMs : 0.0;
+    LOG_SUCCESS("Simulated %d ticks in %.1f ms: %.0f ticks/s (%.1fx real time)",
+                tick, elapsedMs, ticksPerSecond, ticksPerSecond / GameState::GLOBAL_UPDATE_FRAMERATE);
+
+    if (appData.replay.getDivergedTick() >= 0)
+    {
+        LOG_ERROR("Replay diverged at tick %d", appData.replay.getDivergedTick());
+        return 2;
+    }
+
+    return 0;
+}
+
 int GameRunner::run()
 {
     // Initialize all subsystems
@@ -297,16 +495,30 @@ int GameRunner::run()
         LOG_ERROR("Failed to initialize game");
         return 1;
     }
+
+    if (headless)
+    {
+        int result = runHeadless();
+        shutdown();
+        return result;
+    }
     
     LOG_INFO("Entering main game loop");
     LOG_INFO("Press F9 or ` (backtick) to toggle in-game console");
     LOG_INFO("Press TAB to toggle debug overlay");
     
-    // Main game loop
+    // Main game loop - the pacer sleeps until the next frame is due.
+    // Frames are paced at the display refresh rate; each screen's doTick
+    // runs its fixed-rate simulation steps and interpolates the rest.
+    int refreshRate = appData.graph.getRefreshRate();
+    LOG_INFO("Display refresh rate: %d Hz", refreshRate);
+    appData.pacer.setTargetFrameTime(1000.0 / refreshRate);
+    appData.pacer.reset();
     while (!appData.quit)
     {
         processEvents();
         update();
+        appData.pacer.waitForNextFrame();
     }
     
     // Cleanup
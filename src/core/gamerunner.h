@@ -27,6 +27,15 @@ private:
     Uint32 lastFrameTime;
     float deltaTime;
 
+    // Command-line options
+    bool headless;        ///< --headless: no window/audio/input, simulate only
+    int headlessStage;    ///< --stage N: stage to simulate in headless mode (1-based)
+    int headlessTicks;    ///< --ticks N: number of simulation ticks in headless mode
+    bool hasSeed;         ///< --seed N given (otherwise seeded from the clock)
+    bool hasTicks;        ///< --ticks N given (otherwise a replay runs to its end)
+    int directPlayers;    ///< Players created when starting a stage directly (headless/replay)
+    std::string renderCsvPath; ///< --render-csv FILE: render stats history written on exit
+
     // Lifecycle methods
     bool initialize();
     void processEvents();
@@ -34,10 +43,41 @@ private:
     void handleStateTransition();
     void shutdown();
 
+    /**
+     * Headless main loop: drives Scene::moveAll as fast as possible
+     * (no drawAll, no frame pacing) and reports simulated ticks per second.
+     * Returns 2 if a replay with world hashes diverged.
+     */
+    int runHeadless();
+
+    /**
+     * Skip the menus and start a fresh game on headlessStage
+     * (used by headless mode and replay playback)
+     */
+    bool startStageDirect();
+
 public:
     GameRunner();
     ~GameRunner();
 
+    /**
+     * Parse command-line options
+     *
+     * Supported options:
+     *   --headless     Run the simulation without window, audio or input
+     *   --stage N      Stage to simulate in headless mode (default 1)
+     *   --ticks N      Ticks to simulate in headless mode (default 3600)
+     *   --seed N       Seed for gameplay randomness (default: current time)
+     *   --no-atlas     Keep stage sprites in their own textures
+     *   --render-csv FILE  Write the per-frame render stats history as CSV on exit
+     *   --record FILE  Record the next stage played into a replay file
+     *   --record-hashes  Also store the per-tick world hash in recordings
+     *   --replay FILE  Play a replay back (real time, or uncapped with --headless)
+     *
+     * @return false if the arguments are invalid
+     */
+    bool parseArguments(int argc, char* argv[]);
+
     // Main entry point - returns exit code
     int run();
 };
@@ -78,6 +78,7 @@ int Graph::initNormal(const char* title, int windowWidth, int windowHeight) {
 
     // Initialize system font renderer (no BMFont, uses integrated 5x7 bitmap font)
     g_systemFontRenderer.init(this);
+    systemFontTexture = BMFontRenderer::createSystemFontTexture(renderer);
 
     return 1;
 }
@@ -110,6 +111,29 @@ int Graph::initEx(const char* title) {
 
     // Initialize system font renderer (no BMFont, uses integrated 5x7 bitmap font)
     g_systemFontRenderer.init(this);
+    systemFontTexture = BMFontRenderer::createSystemFontTexture(renderer);
+
+    return 1;
+}
+
+int Graph::initHeadless() {
+    headlessTarget = SDL_CreateRGBSurfaceWithFormat(0, RES_X, RES_Y, 32, SDL_PIXELFORMAT_RGBA8888);
+    if (headlessTarget == nullptr) {
+        LOG_ERROR("Headless surface could not be created! SDL_Error: %s", SDL_GetError());
+        return 0;
+    }
+
+    renderer = SDL_CreateSoftwareRenderer(headlessTarget);
+    if (renderer == nullptr) {
+        LOG_ERROR("Software renderer could not be created! SDL_Error: %s", SDL_GetError());
+        return 0;
+    }
+
+    headless = true;
+
+    // Initialize system font renderer (no BMFont, uses integrated 5x7 bitmap font)
+    g_systemFontRenderer.init(this);
+    systemFontTexture = BMFontRenderer::createSystemFontTexture(renderer);
 
     return 1;
 }
@@ -120,6 +144,14 @@ void Graph::setWindowSize(int windowWidth, int windowHeight) {
     }
 }
 
+int Graph::getRefreshRate() const {
+    SDL_DisplayMode dm;
+    int displayIndex = window ? SDL_GetWindowDisplayIndex(window) : 0;
+    if (displayIndex < 0 || SDL_GetCurrentDisplayMode(displayIndex, &dm) != 0 || dm.refresh_rate <= 0)
+        return 60;
+    return dm.refresh_rate;
+}
+
 void Graph::setFullScreen(bool fs) {
     if (fs)
     {
@@ -137,6 +169,10 @@ void Graph::setFullScreen(bool fs) {
 }
 
 void Graph::release() {
+    if (systemFontTexture) {
+        SDL_DestroyTexture(systemFontTexture);
+        systemFontTexture = nullptr;
+    }
     if (backBuffer) {
         SDL_DestroyTexture(backBuffer);
         backBuffer = nullptr;
@@ -149,36 +185,172 @@ void Graph::release() {
         SDL_DestroyWindow(window);
         window = nullptr;
     }
+    if (headlessTarget) {
+        SDL_FreeSurface(headlessTarget);
+        headlessTarget = nullptr;
+    }
     SDL_Quit();
 }
 
+// Untinted, fully opaque vertex/texture color
+static const SDL_Color WHITE = { 255, 255, 255, 255 };
+static const SDL_Point NO_CENTER = { 0, 0 };
+
+void Graph::submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst,
+                   double angle, const SDL_Point& center, SDL_RendererFlip flip,
+                   SDL_Color color, bool additive) {
+    renderStats.countQuad(dst.w, dst.h);
+
+    QueuedQuad quad = { texture, additive, batchLayer, (Uint32)renderQueue.size(),
+                        src, dst, angle, center, flip, color };
+    if (batchDepth > 0)
+        renderQueue.push_back(quad);
+    else
+        drawRun(&quad, 1);
+}
+
+void Graph::drawRun(const QueuedQuad* quads, size_t count) {
+    if (count == 0) return;
+
+    SDL_Texture* texture = quads[0].texture;
+    countTextureUse(texture);
+
+    SDL_BlendMode originalBlend = SDL_BLENDMODE_BLEND;
+    if (quads[0].additive) {
+        // Additive blend with white = solid white silhouette
+        SDL_GetTextureBlendMode(texture, &originalBlend);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_ADD);
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (count > 1) {
+        int texW = 0, texH = 0;
+        SDL_QueryTexture(texture, nullptr, nullptr, &texW, &texH);
+        float invW = texW > 0 ? 1.0f / texW : 0.0f;
+        float invH = texH > 0 ? 1.0f / texH : 0.0f;
+
+        batchVertices.clear();
+        batchIndices.clear();
+        for (size_t i = 0; i < count; i++) {
+            const QueuedQuad& q = quads[i];
+
+            float u0 = q.src.x * invW, u1 = (q.src.x + q.src.w) * invW;
+            float v0 = q.src.y * invH, v1 = (q.src.y + q.src.h) * invH;
+            if (q.flip & SDL_FLIP_HORIZONTAL) std::swap(u0, u1);
+            if (q.flip & SDL_FLIP_VERTICAL) std::swap(v0, v1);
+
+            // Corners relative to the rotation center: TL, TR, BL, BR
+            float cx = (float)q.center.x, cy = (float)q.center.y;
+            float lx[4] = { -cx, q.dst.w - cx, -cx, q.dst.w - cx };
+            float ly[4] = { -cy, -cy, q.dst.h - cy, q.dst.h - cy };
+            float u[4] = { u0, u1, u0, u1 };
+            float v[4] = { v0, v0, v1, v1 };
+
+            float c = 1.0f, s = 0.0f;
+            if (q.angle != 0.0) {
+                double rad = q.angle * (3.14159265358979323846 / 180.0);
+                c = (float)std::cos(rad);
+                s = (float)std::sin(rad);
+            }
+
+            int base = (int)batchVertices.size();
+            for (int k = 0; k < 4; k++) {
+                SDL_Vertex vert;
+                vert.position.x = q.dst.x + cx + lx[k] * c - ly[k] * s;
+                vert.position.y = q.dst.y + cy + lx[k] * s + ly[k] * c;
+                vert.color = q.color;
+                vert.tex_coord.x = u[k];
+                vert.tex_coord.y = v[k];
+                batchVertices.push_back(vert);
+            }
+            static const int QUAD_INDICES[6] = { 0, 1, 2, 2, 1, 3 };
+            for (int k : QUAD_INDICES)
+                batchIndices.push_back(base + k);
+        }
+
+        SDL_RenderGeometry(renderer, texture, batchVertices.data(), (int)batchVertices.size(),
+                           batchIndices.data(), (int)batchIndices.size());
+        renderStats.countDrawCall();
+    }
+    else
+#endif
+    {
+        // Single plain sprite (or no geometry support): one copy per quad
+        for (size_t i = 0; i < count; i++) {
+            const QueuedQuad& q = quads[i];
+            bool tinted = q.color.r != 255 || q.color.g != 255 || q.color.b != 255 || q.color.a != 255;
+            if (tinted) {
+                SDL_SetTextureColorMod(texture, q.color.r, q.color.g, q.color.b);
+                SDL_SetTextureAlphaMod(texture, q.color.a);
+            }
+            if (q.angle != 0.0 || q.flip != SDL_FLIP_NONE)
+                SDL_RenderCopyEx(renderer, texture, &q.src, &q.dst, q.angle, &q.center, q.flip);
+            else
+                SDL_RenderCopy(renderer, texture, &q.src, &q.dst);
+            if (tinted) {
+                SDL_SetTextureColorMod(texture, 255, 255, 255);
+                SDL_SetTextureAlphaMod(texture, 255);
+            }
+            renderStats.countDrawCall();
+        }
+    }
+
+    if (quads[0].additive)
+        SDL_SetTextureBlendMode(texture, originalBlend);
+}
+
+void Graph::flushBatch() {
+    if (renderQueue.empty()) return;
+
+    // Painter's order: by layer, then in submission order. Sorting by
+    // texture as well would let a later sprite slip under an earlier one.
+    std::sort(renderQueue.begin(), renderQueue.end(), [](const QueuedQuad& a, const QueuedQuad& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        return a.seq < b.seq;
+    });
+
+    // Consecutive quads with the same texture and blend mode go out as one run
+    size_t start = 0;
+    while (start < renderQueue.size()) {
+        const QueuedQuad& first = renderQueue[start];
+        size_t end = start + 1;
+        while (end < renderQueue.size() &&
+               renderQueue[end].texture == first.texture && renderQueue[end].additive == first.additive)
+            end++;
+        drawRun(&renderQueue[start], end - start);
+        start = end;
+    }
+    renderQueue.clear();
+}
+
+void Graph::endBatch() {
+    if (batchDepth == 0) return;
+    if (--batchDepth == 0) {
+        flushBatch();
+        batchLayer = 0;
+    }
+}
+
 void Graph::draw(Sprite* spr, int x, int y) {
     if (!spr || !spr->getBmp()) return;
     SDL_Rect srcRect = { spr->getSrcX(), spr->getSrcY(), spr->getWidth(), spr->getHeight() };
     SDL_Rect dstRect = { x + spr->getXOff(), y + spr->getYOff(), spr->getWidth(), spr->getHeight() };
-    SDL_RenderCopy(renderer, spr->getBmp(), &srcRect, &dstRect);
+    submit(spr->getBmp(), srcRect, dstRect, 0.0, NO_CENTER, SDL_FLIP_NONE, WHITE, false);
 }
 
 void Graph::draw(Sprite* spr, int x, int y, bool flipHorizontal) {
     if (!spr || !spr->getBmp()) return;
     SDL_Rect srcRect = { spr->getSrcX(), spr->getSrcY(), spr->getWidth(), spr->getHeight() };
     SDL_Rect dstRect = { x + spr->getXOff(), y + spr->getYOff(), spr->getWidth(), spr->getHeight() };
-
-    if (flipHorizontal) {
-        SDL_RenderCopyEx(renderer, spr->getBmp(), &srcRect, &dstRect,
-                        0.0,
-                        nullptr,
-                        SDL_FLIP_HORIZONTAL);
-    } else {
-        SDL_RenderCopy(renderer, spr->getBmp(), &srcRect, &dstRect);
-    }
+    submit(spr->getBmp(), srcRect, dstRect, 0.0, NO_CENTER,
+           flipHorizontal ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE, WHITE, false);
 }
 
 void Graph::drawScaled(Sprite* spr, int x, int y, int w, int h) {
     if (!spr || !spr->getBmp()) return;
     SDL_Rect srcRect = { spr->getSrcX(), spr->getSrcY(), spr->getWidth(), spr->getHeight() };
     SDL_Rect dstRect = { x + spr->getXOff(), y + spr->getYOff(), w, h };
-    SDL_RenderCopy(renderer, spr->getBmp(), &srcRect, &dstRect);
+    submit(spr->getBmp(), srcRect, dstRect, 0.0, NO_CENTER, SDL_FLIP_NONE, WHITE, false);
 }
 
 void Graph::drawClipped(Sprite* spr, int x, int y, int visibleHeight) {
@@ -191,22 +363,31 @@ void Graph::drawClipped(Sprite* spr, int x, int y, int visibleHeight) {
     SDL_Rect srcRect = { spr->getSrcX(), spr->getSrcY(), spr->getWidth(), clampedHeight };
     // Dest rect: same size as clipped source
     SDL_Rect dstRect = { x + spr->getXOff(), y + spr->getYOff(), spr->getWidth(), clampedHeight };
-    SDL_RenderCopy(renderer, spr->getBmp(), &srcRect, &dstRect);
+    submit(spr->getBmp(), srcRect, dstRect, 0.0, NO_CENTER, SDL_FLIP_NONE, WHITE, false);
 }
 
 void Graph::draw(SDL_Texture* texture, const SDL_Rect* srcRect, int x, int y) {
     SDL_Rect dstRect = { x, y, srcRect->w, srcRect->h };
-    SDL_RenderCopy(renderer, texture, srcRect, &dstRect);
+    submit(texture, *srcRect, dstRect, 0.0, NO_CENTER, SDL_FLIP_NONE, WHITE, false);
+}
+
+void Graph::drawTinted(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst, SDL_Color color) {
+    if (!texture) return;
+    submit(texture, src, dst, 0.0, NO_CENTER, SDL_FLIP_NONE, color, false);
 }
 
 // Extended draw with rendering properties
 void Graph::drawEx(Sprite* spr, const RenderProps& props) {
-    if (!spr || !spr->getBmp()) return;
+    drawTransformed(spr, props, false);
+}
 
-    // Apply alpha
-    if (props.alpha < 1.0f) {
-        SDL_SetTextureAlphaMod(spr->getBmp(), (Uint8)(props.alpha * 255.0f));
-    }
+// Extended draw with flash effect (additive blend for white silhouette)
+void Graph::drawExFlash(Sprite* spr, const RenderProps& props, bool flashWhite) {
+    drawTransformed(spr, props, flashWhite);
+}
+
+void Graph::drawTransformed(Sprite* spr, const RenderProps& props, bool additive) {
+    if (!spr || !spr->getBmp()) return;
 
     // Source rectangle (from sprite sheet)
     SDL_Rect srcRect = { spr->getSrcX(), spr->getSrcY(), spr->getWidth(), spr->getHeight() };
@@ -234,50 +415,16 @@ void Graph::drawEx(Sprite* spr, const RenderProps& props) {
     };
 
     // Flip flags
-    SDL_RendererFlip flip = SDL_FLIP_NONE;
-    if (props.flipH && props.flipV) {
-        flip = (SDL_RendererFlip)(SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
-    } else if (props.flipH) {
-        flip = SDL_FLIP_HORIZONTAL;
-    } else if (props.flipV) {
-        flip = SDL_FLIP_VERTICAL;
-    }
-
-    // Render with all transformations
-    SDL_RenderCopyEx(renderer, spr->getBmp(), &srcRect, &dstRect, props.rotation, &center, flip);
-
-    // Reset alpha
-    if (props.alpha < 1.0f) {
-        SDL_SetTextureAlphaMod(spr->getBmp(), 255);
-    }
-}
-
-// Extended draw with flash effect (additive blend for white silhouette)
-void Graph::drawExFlash(Sprite* spr, const RenderProps& props, bool flashWhite) {
-    if (!spr || !spr->getBmp()) return;
-
-    SDL_Texture* tex = spr->getBmp();
-
-    // Save original blend mode
-    SDL_BlendMode originalBlend;
-    SDL_GetTextureBlendMode(tex, &originalBlend);
-
-    if (flashWhite)
-    {
-        // Additive blend with white = solid white silhouette
-        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_ADD);
-        SDL_SetTextureColorMod(tex, 255, 255, 255);
-    }
+    int flip = SDL_FLIP_NONE;
+    if (props.flipH) flip |= SDL_FLIP_HORIZONTAL;
+    if (props.flipV) flip |= SDL_FLIP_VERTICAL;
 
-    // Draw using existing drawEx logic
-    drawEx(spr, props);
+    // Alpha travels with the quad instead of the texture's alpha mod
+    SDL_Color color = WHITE;
+    if (props.alpha < 1.0f)
+        color.a = (Uint8)(std::max(props.alpha, 0.0f) * 255.0f);
 
-    if (flashWhite)
-    {
-        // Restore original state
-        SDL_SetTextureBlendMode(tex, originalBlend);
-        SDL_SetTextureColorMod(tex, 255, 255, 255);  // Reset to neutral
-    }
+    submit(spr->getBmp(), srcRect, dstRect, props.rotation, center, (SDL_RendererFlip)flip, color, additive);
 }
 
 // New methods using Sprite2D's internal properties
@@ -291,11 +438,6 @@ void Graph::draw(Sprite2D* spr) {
     // Use drawEx with properties from Sprite2D
     RenderProps props = RenderProps::fromSprite2D(spr);
     drawEx(currentSprite, props);
-
-    // Reset alpha if modified
-    if (spr->getAlpha() < 255.0f) {
-        SDL_SetTextureAlphaMod(currentSprite->getBmp(), 255);
-    }
 }
 
 void Graph::draw(BmNumFont* font, int num, int x, int y) {
@@ -317,15 +459,25 @@ void Graph::draw(BmNumFont* font, const std::string& cad, int x, int y) {
     SDL_Rect srcRect;
     int esp = 0;
 
+    beginBatch();
     for (char c : cad) {
         srcRect = font->getRect(c);
         draw(font->getSprite()->getBmp(), &srcRect, x + esp, y);
         esp += srcRect.w;
     }
+    endBatch();
 }
 
 void Graph::flip() {
-    SDL_RenderPresent(renderer);
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    flushBatch();
+    if (!headless)
+        SDL_RenderPresent(renderer);
+
+    double ms = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    renderStats.endFrame((float)ms);
+    lastTexture = nullptr;
 }
 
 void Graph::text(const char texto[], int x, int y) {
@@ -339,12 +491,16 @@ void Graph::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
 }
 
 void Graph::rectangle(int a, int b, int c, int d) {
+    flushBatch();
+    renderStats.countPrimitive();
     SDL_Rect rect = { a, b, c - a, d - b };
     SDL_RenderDrawRect(renderer, &rect);
 }
 
 void Graph::filledRectangle(int a, int b, int c, int d) {
+    flushBatch();
     SDL_Rect rect = { a, b, c - a, d - b };
+    renderStats.countPrimitive(1, rect.w > 0 && rect.h > 0 ? (Uint64)rect.w * rect.h : 0);
     SDL_RenderFillRect(renderer, &rect);
 }
 
@@ -355,6 +511,8 @@ void Graph::drawArrow(int x0, int y0, int x1, int y1, int thickness)
     float len = std::sqrt(dx * dx + dy * dy);
     if (len < 1.0f) return;
 
+    flushBatch();
+
     float ndx = dx / len;   // normalised direction
     float ndy = dy / len;
     float px  = -ndy;       // perpendicular
@@ -383,9 +541,12 @@ void Graph::drawArrow(int x0, int y0, int x1, int y1, int thickness)
 
     SDL_RenderDrawLine(renderer, x1, y1, ax1, ay1);
     SDL_RenderDrawLine(renderer, x1, y1, ax2, ay2);
+    renderStats.countPrimitive((Uint32)(2 * half + 3));
 }
 
 void Graph::circle(int cx, int cy, int radius) {
+    flushBatch();
+
     // Midpoint circle algorithm
     int x = radius;
     int y = 0;
@@ -400,6 +561,7 @@ void Graph::circle(int cx, int cy, int radius) {
         SDL_RenderDrawPoint(renderer, cx - y, cy - x);
         SDL_RenderDrawPoint(renderer, cx + y, cy - x);
         SDL_RenderDrawPoint(renderer, cx + x, cy - y);
+        renderStats.countPrimitive(8);
 
         if (err <= 0) {
             y += 1;
@@ -425,6 +587,7 @@ void Graph::loadBitmap(Sprite* spr, const char* szBitmap) {
         LOG_ERROR("Unable to create texture from %s! SDL Error: %s", szBitmap, SDL_GetError());
     } else {
         spr->bmp = newTexture;
+        spr->ownsBmp = true;
         spr->sx = loadedSurface->w;
         spr->sy = loadedSurface->h;
     }
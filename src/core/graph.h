@@ -7,7 +7,9 @@
 
 #include <SDL.h>
 #include <string>
+#include <vector>
 #include "renderprops.h"
+#include "renderstats.h"
 
 // Forward declarations
 class Sprite;
@@ -62,7 +64,7 @@ class Graph;
  * using SDL2. It handles:
  * - Graphics system initialization and cleanup
  * - Window and renderer management
- * - Sprite and texture rendering
+ * - Sprite and texture rendering, optionally batched through a render queue
  * - Primitive drawing operations (rectangles, text)
  * - Bitmap loading and color key management
  * - Screen flipping and fullscreen toggling
@@ -78,6 +80,51 @@ private:
     SDL_Renderer* renderer;     ///< SDL renderer handle
     SDL_Texture* backBuffer;    ///< Back buffer texture for double buffering
     int mode;                   ///< Current rendering mode (RENDERMODE_NORMAL or RENDERMODE_EXCLUSIVE)
+    SDL_Surface* headlessTarget; ///< Offscreen surface backing the software renderer (headless only)
+    bool headless;              ///< No window: nothing is ever presented
+    SDL_Texture* systemFontTexture; ///< Glyphs of the built-in 5x7 font (Graph::text, system font renderers)
+    SDL_Texture* lastTexture;   ///< Texture of the previous sprite draw (switch counting)
+    RenderStats renderStats;    ///< Per-frame render counters and history
+
+    /// A textured quad waiting in the render queue
+    struct QueuedQuad
+    {
+        SDL_Texture* texture;
+        bool additive;          ///< Drawn with SDL_BLENDMODE_ADD (flash silhouette)
+        int layer;
+        Uint32 seq;             ///< Submission order (kept within a run)
+        SDL_Rect src;
+        SDL_Rect dst;
+        double angle;           ///< Degrees clockwise around center
+        SDL_Point center;       ///< Rotation center, relative to dst
+        SDL_RendererFlip flip;
+        SDL_Color color;        ///< Tint and alpha (white = untinted)
+    };
+
+    std::vector<QueuedQuad> renderQueue;    ///< Quads queued since the last flush
+    int batchDepth;             ///< Nesting of beginBatch()/endBatch()
+    int batchLayer;             ///< Layer given to newly queued quads
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    std::vector<SDL_Vertex> batchVertices;  ///< Geometry of the run being flushed (reused)
+    std::vector<int> batchIndices;
+#endif
+
+    /**
+     * @brief Queue a quad while batching, otherwise render it immediately
+     */
+    void submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst,
+                double angle, const SDL_Point& center, SDL_RendererFlip flip,
+                SDL_Color color, bool additive);
+
+    /**
+     * @brief Render a run of queued quads sharing texture and blend mode
+     */
+    void drawRun(const QueuedQuad* quads, size_t count);
+
+    /**
+     * @brief Shared implementation of drawEx() and drawExFlash()
+     */
+    void drawTransformed(Sprite* spr, const RenderProps& props, bool additive);
 
 public:
     /**
@@ -85,7 +132,9 @@ public:
      * 
      * Initializes all pointers to nullptr and mode to 0.
      */
-    Graph() : window(nullptr), renderer(nullptr), backBuffer(nullptr), mode(0) {}
+    Graph() : window(nullptr), renderer(nullptr), backBuffer(nullptr), mode(0),
+              headlessTarget(nullptr), headless(false), systemFontTexture(nullptr), lastTexture(nullptr),
+              batchDepth(0), batchLayer(0) {}
 
     /**
      * @brief Initialize the graphics system with specified mode
@@ -114,6 +163,22 @@ public:
      */
     int initEx(const char* title);
 
+    /**
+     * @brief Initialize graphics system without a window (headless mode)
+     *
+     * Creates a software renderer on an offscreen surface, so textures can
+     * still be loaded (sprite dimensions drive collision sizes) but nothing
+     * is ever shown. Works on machines without a display.
+     *
+     * @return 1 on success, 0 on failure
+     */
+    int initHeadless();
+
+    /**
+     * @brief Check if the graphics system runs without a window
+     */
+    bool isHeadless() const { return headless; }
+
     /**
      * @brief Release all graphics resources
      * 
@@ -245,6 +310,99 @@ public:
      */
     void flip();
 
+    /**
+     * @brief Count a draw from texture (a switch if it differs from the previous draw)
+     *
+     * Called by every Graph sprite draw; code issuing its own SDL_RenderCopy
+     * calls it too so the count stays complete.
+     */
+    void countTextureUse(SDL_Texture* texture)
+    {
+        bool switched = texture != lastTexture;
+        lastTexture = texture;
+        renderStats.countTexture(texture, switched);
+    }
+
+    /**
+     * @brief Count untextured render calls issued outside Graph's primitives
+     *
+     * @param calls Render calls
+     * @param pixels Area filled (0 for outlines, lines and points)
+     */
+    void countPrimitive(Uint32 calls, Uint64 pixels = 0) { renderStats.countPrimitive(calls, pixels); }
+
+    /**
+     * @brief Texture switches in the last frame passed to flip()
+     */
+    Uint32 getTextureSwitches() const { return renderStats.last().textureSwitches; }
+
+    /**
+     * @brief Texture render calls (SDL_RenderCopy/RenderGeometry) in the last frame passed to flip()
+     */
+    Uint32 getDrawCalls() const { return renderStats.last().drawCalls; }
+
+    /**
+     * @brief Render counters of the last frames (see /renderstats)
+     */
+    const RenderStats& getRenderStats() const { return renderStats; }
+    RenderStats& getRenderStats() { return renderStats; }
+
+    /**
+     * @brief Start collecting sprite draws into the render queue
+     *
+     * Until the matching endBatch(), every textured draw (draw, drawEx,
+     * drawExFlash, drawScaled, drawClipped, BmNumFont and BMFont text) is
+     * queued as a quad instead of rendered. Alpha, tint, flip and rotation
+     * travel with the quad, so no texture state is touched per sprite.
+     *
+     * Batches nest; the queue is flushed when the outermost one ends.
+     */
+    void beginBatch() { batchDepth++; }
+
+    /**
+     * @brief End a batch, flushing the queue when the outermost batch ends
+     */
+    void endBatch();
+
+    /**
+     * @brief Render everything queued so far
+     *
+     * Quads are drawn by layer, and in submission order within a layer, so
+     * the result matches unbatched drawing. Consecutive quads sharing a
+     * texture and blend mode are merged into a single SDL_RenderGeometry
+     * call (SDL 2.0.18+); packing sprites into an atlas makes those runs
+     * long.
+     *
+     * Untextured primitives (rectangle, circle, system font text) flush
+     * first so they stay above what was drawn before them.
+     */
+    void flushBatch();
+
+    bool isBatching() const { return batchDepth > 0; }
+
+    /**
+     * @brief Set the layer of subsequently queued quads (lower layers draw first)
+     */
+    void setLayer(int layer) { batchLayer = layer; }
+    int getLayer() const { return batchLayer; }
+
+    /**
+     * @brief Draw a tinted region of a texture (queued while batching)
+     *
+     * @param texture Source texture
+     * @param src Source rectangle
+     * @param dst Destination rectangle (scaled to fit)
+     * @param color Tint and alpha
+     */
+    void drawTinted(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst, SDL_Color color);
+
+    /**
+     * @brief Get the refresh rate of the display showing the window
+     *
+     * @return Refresh rate in Hz (60 if unknown)
+     */
+    int getRefreshRate() const;
+
     /**
      * @brief Toggle fullscreen mode
      * 
@@ -270,7 +428,8 @@ public:
     /**
      * @brief Draw text on screen
      * 
-     * Uses SDL's built-in text rendering capabilities.
+     * Uses the built-in 5x7 font: one quad per character from the system
+     * font glyph texture, drawn as one batch per string.
      * 
      * @param texto Text string to draw
      * @param x X coordinate on screen
@@ -376,4 +535,11 @@ public:
      */
     SDL_Renderer* getRenderer() const { return renderer; }
     SDL_Window*   getWindow()   const { return window; }
+
+    /**
+     * @brief Get the glyph texture of the built-in 5x7 font
+     *
+     * @return Texture laid out by BMFontRenderer::createSystemFontTexture(), or nullptr
+     */
+    SDL_Texture* getSystemFontTexture() const { return systemFontTexture; }
 };
@@ -1,4 +1,5 @@
 #include <SDL.h>
+#include <cstring>
 #include "minput.h"
 #include "appconsole.h"
 
@@ -12,7 +13,8 @@ MInput::~MInput()
 
 bool MInput::init()
 {
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) != 0)
+    Uint32 flags = headless ? SDL_INIT_EVENTS : (SDL_INIT_VIDEO | SDL_INIT_EVENTS);
+    if (SDL_Init(flags) != 0)
         return false;
 
     return true;
@@ -20,6 +22,12 @@ bool MInput::init()
 
 bool MInput::key(SDL_Scancode k)
 {
+    if (injecting)
+        return injectedKeys[k] != 0;
+
+    if (headless)
+        return false;
+
     // Block all game input when AppConsole is visible
     if (AppConsole::instance().isVisible())
     {
@@ -30,6 +38,11 @@ bool MInput::key(SDL_Scancode k)
     return keyState[k] != 0;
 }
 
+void MInput::clearInjectedKeys()
+{
+    std::memset(injectedKeys, 0, sizeof(injectedKeys));
+}
+
 bool MInput::reacquireInput()
 {
     return true;
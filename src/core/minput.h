@@ -10,6 +10,11 @@
  */
 class MInput
 {
+private:
+    bool headless = false;  ///< No keyboard: key() always reports released
+    bool injecting = false; ///< key() reads injectedKeys instead of the keyboard (replay)
+    Uint8 injectedKeys[SDL_NUM_SCANCODES] = {};
+
 public:
     MInput();
     ~MInput();
@@ -17,5 +22,22 @@ public:
     bool init();
     bool key(SDL_Scancode k);
     bool reacquireInput();
+
+    /**
+     * Enable headless mode (must be called before init()).
+     * Only the SDL event subsystem is started and no key reads as pressed.
+     */
+    void setHeadless(bool enabled) { headless = enabled; }
+    bool isHeadless() const { return headless; }
+
+    /**
+     * Injected input (replay playback).
+     * While injecting, key() returns the injected state and ignores both
+     * the keyboard and headless mode.
+     */
+    void setInjecting(bool enabled) { injecting = enabled; }
+    bool isInjecting() const { return injecting; }
+    void setInjectedKey(SDL_Scancode k, bool down) { injectedKeys[k] = down ? 1 : 0; }
+    void clearInjectedKeys();
 };
 
@@ -2,20 +2,49 @@
 #include "animspritesheet.h"
 #include "sprite.h"
 
-void MultiAnimSprite::registerAnimation(const std::string& name, AnimSpriteSheet* anim)
+MultiAnimSprite::AnimId MultiAnimSprite::registerAnimation(const std::string& name, AnimSpriteSheet* anim)
 {
-    if (anim)
+    if (!anim)
+    {
+        return NO_ANIM;
+    }
+
+    AnimId id = findAnimation(name);
+    if (id == NO_ANIM)
+    {
+        id = static_cast<AnimId>(animations.size());
+        animations.push_back(anim);
+        animNames.push_back(name);
+    }
+    else
+    {
+        animations[id] = anim;
+    }
+    return id;
+}
+
+MultiAnimSprite::AnimId MultiAnimSprite::findAnimation(const std::string& name) const
+{
+    // Only a handful of animations per entity: a linear scan beats hashing
+    for (size_t i = 0; i < animNames.size(); i++)
     {
-        animations[name] = anim;
+        if (animations[i] && animNames[i] == name)
+            return static_cast<AnimId>(i);
     }
+    return NO_ANIM;
 }
 
 void MultiAnimSprite::unregisterAnimation(const std::string& name)
 {
-    animations.erase(name);
-    if (activeAnimKey == name)
+    AnimId id = findAnimation(name);
+    if (id == NO_ANIM)
+        return;
+
+    // Keep the slot so other ids stay valid
+    animations[id] = nullptr;
+    if (activeAnim == id)
     {
-        activeAnimKey.clear();
+        activeAnim = NO_ANIM;
         useFallback = true;
     }
 }
@@ -23,7 +52,8 @@ void MultiAnimSprite::unregisterAnimation(const std::string& name)
 void MultiAnimSprite::clearAnimations()
 {
     animations.clear();
-    activeAnimKey.clear();
+    animNames.clear();
+    activeAnim = NO_ANIM;
     useFallback = true;
 }
 
@@ -68,15 +98,14 @@ void MultiAnimSprite::setFallbackFrame(int frame)
         fallbackFrame = frame;
 }
 
-bool MultiAnimSprite::setActiveAnimation(const std::string& name)
+bool MultiAnimSprite::setActiveAnimation(AnimId id)
 {
-    auto it = animations.find(name);
-    if (it == animations.end())
+    if (!getAnimation(id))
     {
         return false;
     }
 
-    activeAnimKey = name;
+    activeAnim = id;
     useFallback = false;
     return true;
 }
@@ -84,7 +113,14 @@ bool MultiAnimSprite::setActiveAnimation(const std::string& name)
 void MultiAnimSprite::useAsFallback()
 {
     useFallback = true;
-    activeAnimKey.clear();
+    activeAnim = NO_ANIM;
+}
+
+const std::string& MultiAnimSprite::getActiveAnimKey() const
+{
+    static const std::string none;
+    AnimId id = getActiveAnimId();
+    return id != NO_ANIM ? animNames[id] : none;
 }
 
 void MultiAnimSprite::update(float dtMs)
@@ -125,27 +161,18 @@ Sprite* MultiAnimSprite::getActiveSprite() const
 
 AnimSpriteSheet* MultiAnimSprite::getActiveAnimation() const
 {
-    if (useFallback || activeAnimKey.empty())
+    if (useFallback)
         return nullptr;
 
-    auto it = animations.find(activeAnimKey);
-    if (it != animations.end())
-    {
-        return it->second;
-    }
-
-    // Animation key is set but animation not found - inconsistent state
-    // This can happen if animation was unregistered after being set active
-    // Gracefully handle by returning nullptr
-    return nullptr;
+    // nullptr if the active animation was unregistered after being set active
+    return getAnimation(activeAnim);
 }
 
-AnimSpriteSheet* MultiAnimSprite::getAnimation(const std::string& name) const
+AnimSpriteSheet* MultiAnimSprite::getAnimation(AnimId id) const
 {
-    auto it = animations.find(name);
-    if (it != animations.end())
+    if (id >= 0 && id < static_cast<AnimId>(animations.size()))
     {
-        return it->second;
+        return animations[id];
     }
     return nullptr;
 }
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "isprite.h"
-#include <unordered_map>
 #include <string>
 #include <vector>
 
@@ -17,14 +16,18 @@ class Sprite;
  * The AnimSpriteSheets are non-owning references - the entity owns them.
  * This class just provides a unified way to switch between them.
  *
+ * registerAnimation() returns an integer AnimId; keep it and switch with
+ * setActiveAnimation(AnimId) so state changes are an index, not a string
+ * lookup. Names are kept for tools and debugging.
+ *
  * Usage:
  *   MultiAnimSprite sprite;
- *   sprite.registerAnimation("walk", walkAnim.get());
- *   sprite.registerAnimation("victory", victoryAnim.get());
+ *   walkId = sprite.registerAnimation("walk", walkAnim.get());
+ *   victoryId = sprite.registerAnimation("victory", victoryAnim.get());
  *   sprite.setFallbackSprite(idleSprite);
  *
  *   // In setState():
- *   sprite.setActiveAnimation("walk");
+ *   sprite.setActiveAnimation(walkId);
  *
  *   // In update():
  *   sprite.update(dtMs);
@@ -34,16 +37,21 @@ class Sprite;
  */
 class MultiAnimSprite : public ISprite
 {
+public:
+    using AnimId = int;
+    static constexpr AnimId NO_ANIM = -1;
+
 private:
-    // Named animations (non-owning references)
-    std::unordered_map<std::string, AnimSpriteSheet*> animations;
+    // Registered animations indexed by AnimId (non-owning; nullptr once unregistered)
+    std::vector<AnimSpriteSheet*> animations;
+    std::vector<std::string> animNames;
 
     // Fallback sprites for states without animation (e.g., IDLE, SHOOT, DEAD)
     std::vector<Sprite*> fallbackSprites;
     int fallbackFrame = 0;
 
-    // Currently active animation key
-    std::string activeAnimKey;
+    // Currently active animation
+    AnimId activeAnim = NO_ANIM;
     bool useFallback = true;
 
 public:
@@ -52,10 +60,20 @@ public:
 
     /**
      * Register a named animation (non-owning reference)
+     *
+     * Registering an existing name replaces its animation and keeps its id.
+     *
      * @param name Animation name (e.g., "walk", "victory", "climb")
      * @param anim Pointer to AnimSpriteSheet owned by entity
+     * @return Id for setActiveAnimation(), or NO_ANIM if anim is nullptr
+     */
+    AnimId registerAnimation(const std::string& name, AnimSpriteSheet* anim);
+
+    /**
+     * Look up the id of a registered animation
+     * @return Animation id, or NO_ANIM if not registered
      */
-    void registerAnimation(const std::string& name, AnimSpriteSheet* anim);
+    AnimId findAnimation(const std::string& name) const;
 
     /**
      * Unregister a named animation
@@ -94,11 +112,18 @@ public:
     int getFallbackFrame() const { return fallbackFrame; }
 
     /**
-     * Activate a named animation
+     * Activate an animation by id
+     * @param id Id returned by registerAnimation()
+     * @return true if animation exists and was activated
+     */
+    bool setActiveAnimation(AnimId id);
+
+    /**
+     * Activate a named animation (tools and debugging)
      * @param name Animation name
      * @return true if animation exists and was activated
      */
-    bool setActiveAnimation(const std::string& name);
+    bool setActiveAnimation(const std::string& name) { return setActiveAnimation(findAnimation(name)); }
 
     /**
      * Switch to using fallback sprite instead of animation
@@ -110,10 +135,15 @@ public:
      */
     bool isUsingFallback() const { return useFallback; }
 
+    /**
+     * Get current animation id (NO_ANIM if using fallback)
+     */
+    AnimId getActiveAnimId() const { return useFallback ? NO_ANIM : activeAnim; }
+
     /**
      * Get current animation key (empty if using fallback)
      */
-    const std::string& getActiveAnimKey() const { return activeAnimKey; }
+    const std::string& getActiveAnimKey() const;
 
     /**
      * Update active animation (if not using fallback)
@@ -131,10 +161,15 @@ public:
      */
     AnimSpriteSheet* getActiveAnimation() const;
 
+    /**
+     * Get animation by id (nullptr if not found)
+     */
+    AnimSpriteSheet* getAnimation(AnimId id) const;
+
     /**
      * Get animation by name (nullptr if not found)
      */
-    AnimSpriteSheet* getAnimation(const std::string& name) const;
+    AnimSpriteSheet* getAnimation(const std::string& name) const { return getAnimation(findAnimation(name)); }
 
     /**
      * Get width - for animations, returns animation width; for fallback, returns sprite width
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @class Random
+ * @brief Small, fast, explicitly seeded PRNG (xoshiro128**)
+ *
+ * Replaces the global std::rand() for gameplay randomness so that a run is
+ * fully determined by its seed. The 128-bit state is expanded from a 64-bit
+ * seed with splitmix64, so nearby seeds still produce unrelated sequences.
+ *
+ * Each generator is independent: a Scene owns its own instance, which keeps
+ * unrelated systems (menus, effects) from perturbing the gameplay stream.
+ *
+ * Usage:
+ *   Random rng(seed);
+ *   int x = rng.range(32, 632);   // [32, 632)
+ *   bool heads = rng.chance();    // 50/50
+ */
+class Random
+{
+private:
+    uint32_t s[4];     ///< Generator state
+    uint64_t seedVal;  ///< Seed the state was derived from
+
+    static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    static uint64_t splitmix64(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+public:
+    explicit Random(uint64_t seed = 0) { reseed(seed); }
+
+    /**
+     * @brief Reset the generator to the start of the sequence for a seed
+     */
+    void reseed(uint64_t seed)
+    {
+        seedVal = seed;
+        uint64_t x = seed;
+        uint64_t a = splitmix64(x);
+        uint64_t b = splitmix64(x);
+        s[0] = (uint32_t)a;
+        s[1] = (uint32_t)(a >> 32);
+        s[2] = (uint32_t)b;
+        s[3] = (uint32_t)(b >> 32);
+    }
+
+    uint64_t getSeed() const { return seedVal; }
+
+    /**
+     * @brief Next raw 32-bit value
+     */
+    uint32_t next()
+    {
+        uint32_t result = rotl(s[1] * 5, 7) * 9;
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    /**
+     * @brief Uniform integer in [0, n) (multiply-shift, no modulo)
+     */
+    int nextInt(int n)
+    {
+        if (n <= 0) return 0;
+        return (int)(((uint64_t)next() * (uint32_t)n) >> 32);
+    }
+
+    /**
+     * @brief Uniform integer in [lo, hi)
+     */
+    int range(int lo, int hi) { return lo + nextInt(hi - lo); }
+
+    /**
+     * @brief Fair coin flip
+     */
+    bool chance() { return (next() >> 31) != 0; }
+
+    /**
+     * @brief Combine a base seed with a stream id (e.g. stage number)
+     *
+     * Gives every stage its own reproducible sequence from a single game seed.
+     */
+    static uint64_t deriveSeed(uint64_t base, uint64_t stream)
+    {
+        uint64_t x = base ^ (stream * 0xD1B54A32D192ED03ULL);
+        return splitmix64(x);
+    }
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <SDL.h>
+
+/**
+ * RecyclePool class
+ *
+ * Fixed-capacity pool of short-lived objects that are reset in place
+ * instead of destroyed and rebuilt (effects, score popups).
+ *
+ * All capacity objects are default-constructed up front. acquire() hands
+ * out a free object, which the caller re-initialises (typically with a
+ * reset() method that reuses buffers and cloned animations the object
+ * already owns). Objects released with removeIf() go back to the free
+ * list without being destroyed.
+ *
+ * When every object is in use, acquire() recycles the oldest live one
+ * (drop-oldest): under overload the newest effects win and nothing is
+ * allocated. getDropped() counts how often that happened.
+ *
+ * Live objects are iterated in acquisition order (for (T* obj : pool)),
+ * so older objects draw first.
+ */
+template<typename T>
+class RecyclePool
+{
+public:
+    using iterator = typename std::vector<T*>::const_iterator;
+
+    explicit RecyclePool(size_t capacity) { setCapacity(capacity); }
+
+    RecyclePool(const RecyclePool&) = delete;
+    RecyclePool& operator=(const RecyclePool&) = delete;
+
+    /**
+     * @brief Change the capacity (at least 1). Destroys all objects, live ones included.
+     */
+    void setCapacity(size_t capacity)
+    {
+        capacity = std::max<size_t>(capacity, 1);
+        live.clear();
+        freeList.clear();
+        storage.reset(new T[capacity]);
+        cap = capacity;
+
+        live.reserve(cap);
+        freeList.reserve(cap);
+        for (size_t i = cap; i > 0; i--)
+            freeList.push_back(&storage[i - 1]);
+    }
+
+    /**
+     * @brief Take an object for a new spawn, recycling the oldest live one if full
+     * @return Object to re-initialise (never nullptr)
+     */
+    T* acquire()
+    {
+        T* obj;
+        if (!freeList.empty())
+        {
+            obj = freeList.back();
+            freeList.pop_back();
+        }
+        else
+        {
+            obj = live.front();
+            live.erase(live.begin());
+            dropped++;
+        }
+        live.push_back(obj);
+        return obj;
+    }
+
+    /**
+     * @brief Return every live object matching pred to the free list (order of the rest is kept)
+     * @return Number of objects released
+     */
+    template<typename Pred>
+    size_t removeIf(Pred pred)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < live.size(); i++)
+        {
+            T* obj = live[i];
+            if (pred(static_cast<const T*>(obj)))
+                freeList.push_back(obj);
+            else
+                live[kept++] = obj;
+        }
+        size_t removed = live.size() - kept;
+        live.resize(kept);
+        return removed;
+    }
+
+    /**
+     * @brief Release all live objects
+     */
+    void clear() { removeIf([](const T*) { return true; }); }
+
+    size_t size() const { return live.size(); }
+    bool empty() const { return live.empty(); }
+    size_t capacity() const { return cap; }
+
+    /// Live objects recycled by acquire() because the pool was full
+    Uint64 getDropped() const { return dropped; }
+    void resetDropped() { dropped = 0; }
+
+    iterator begin() const { return live.begin(); }
+    iterator end() const { return live.end(); }
+
+private:
+    std::unique_ptr<T[]> storage;   ///< All objects (never moves until setCapacity)
+    std::vector<T*> live;           ///< In use, oldest first
+    std::vector<T*> freeList;       ///< Available for acquire()
+    size_t cap = 0;
+    Uint64 dropped = 0;
+};
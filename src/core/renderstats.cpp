@@ -0,0 +1,110 @@
+#include "renderstats.h"
+#include <algorithm>
+#include <cstdio>
+
+RenderStats::RenderStats()
+    : history(HISTORY_FRAMES), head(0), count(0), frameNumber(0)
+{
+    frameTextures.reserve(64);
+}
+
+void RenderStats::countTexture(SDL_Texture* texture, bool switched)
+{
+    if (!switched)
+        return;     // Same texture as the previous draw: already counted
+
+    current.textureSwitches++;
+    if (std::find(frameTextures.begin(), frameTextures.end(), texture) == frameTextures.end())
+    {
+        frameTextures.push_back(texture);
+        current.texturesBound++;
+    }
+}
+
+void RenderStats::endFrame(float flipMs)
+{
+    current.frame = frameNumber++;
+    current.flipMs = flipMs;
+    lastFrame = current;
+
+    history[head] = current;
+    head = (head + 1) % HISTORY_FRAMES;
+    if (count < HISTORY_FRAMES)
+        count++;
+
+    current = Frame();
+    frameTextures.clear();
+}
+
+void RenderStats::clear()
+{
+    head = 0;
+    count = 0;
+}
+
+RenderStats::Summary RenderStats::summarize() const
+{
+    Summary s;
+    s.frames = count;
+    if (count == 0)
+        return s;
+
+    Uint64 drawCalls = 0, switches = 0, bound = 0, quads = 0, primitives = 0;
+    Uint64 spritePixels = 0, primitivePixels = 0;
+    double flipMs = 0.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const Frame& f = at(i);
+        drawCalls += f.drawCalls;
+        switches += f.textureSwitches;
+        bound += f.texturesBound;
+        quads += f.quads;
+        primitives += f.primitives;
+        spritePixels += f.spritePixels;
+        primitivePixels += f.primitivePixels;
+        flipMs += f.flipMs;
+
+        s.peak.drawCalls = std::max(s.peak.drawCalls, f.drawCalls);
+        s.peak.textureSwitches = std::max(s.peak.textureSwitches, f.textureSwitches);
+        s.peak.texturesBound = std::max(s.peak.texturesBound, f.texturesBound);
+        s.peak.quads = std::max(s.peak.quads, f.quads);
+        s.peak.primitives = std::max(s.peak.primitives, f.primitives);
+        s.peak.spritePixels = std::max(s.peak.spritePixels, f.spritePixels);
+        s.peak.primitivePixels = std::max(s.peak.primitivePixels, f.primitivePixels);
+        s.peak.flipMs = std::max(s.peak.flipMs, f.flipMs);
+    }
+
+    Uint64 n = count;
+    s.mean.drawCalls = (Uint32)((drawCalls + n / 2) / n);
+    s.mean.textureSwitches = (Uint32)((switches + n / 2) / n);
+    s.mean.texturesBound = (Uint32)((bound + n / 2) / n);
+    s.mean.quads = (Uint32)((quads + n / 2) / n);
+    s.mean.primitives = (Uint32)((primitives + n / 2) / n);
+    s.mean.spritePixels = (spritePixels + n / 2) / n;
+    s.mean.primitivePixels = (primitivePixels + n / 2) / n;
+    s.mean.flipMs = (float)(flipMs / (double)n);
+    return s;
+}
+
+bool RenderStats::writeCsv(const std::string& path, int screenW, int screenH) const
+{
+    FILE* fp = fopen(path.c_str(), "w");
+    if (!fp)
+        return false;
+
+    std::fprintf(fp, "frame,draw_calls,texture_switches,textures_bound,quads,primitives,"
+                     "sprite_pixels,primitive_pixels,overdraw,flip_ms\n");
+    for (size_t i = 0; i < count; i++)
+    {
+        const Frame& f = at(i);
+        std::fprintf(fp, "%llu,%u,%u,%u,%u,%u,%llu,%llu,%.3f,%.3f\n",
+                     (unsigned long long)f.frame, (unsigned)f.drawCalls, (unsigned)f.textureSwitches,
+                     (unsigned)f.texturesBound, (unsigned)f.quads, (unsigned)f.primitives,
+                     (unsigned long long)f.spritePixels, (unsigned long long)f.primitivePixels,
+                     f.overdraw(screenW, screenH), f.flipMs);
+    }
+
+    bool ok = std::ferror(fp) == 0;
+    fclose(fp);
+    return ok;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+/**
+ * RenderStats class
+ *
+ * Per-frame render cost counters kept by Graph, with a ring buffer of the
+ * last HISTORY_FRAMES frames.
+ *
+ * Graph feeds the current frame as it draws (texture uses, quads, draw
+ * calls, untextured primitives) and closes it in flip() with endFrame().
+ * Sprite pixels are the destination area of every textured quad, so
+ * spritePixels / screen area estimates overdraw; off-screen parts are
+ * included.
+ *
+ * Inspect with /renderstats; writeCsv() dumps the history (see --render-csv).
+ */
+class RenderStats
+{
+public:
+    static constexpr size_t HISTORY_FRAMES = 600;  ///< 10 s at 60 fps
+
+    /**
+     * @brief Counters of one frame
+     */
+    struct Frame
+    {
+        Uint64 frame = 0;               ///< Frame number (flip() count)
+        Uint32 drawCalls = 0;           ///< Textured render calls (RenderCopy/RenderGeometry)
+        Uint32 textureSwitches = 0;     ///< Draws using a different texture than the previous one
+        Uint32 texturesBound = 0;       ///< Distinct textures drawn from
+        Uint32 quads = 0;               ///< Textured quads drawn (batched or not)
+        Uint32 primitives = 0;          ///< Untextured render calls (rects, lines, points, system font pixels)
+        Uint64 spritePixels = 0;        ///< Destination area of all textured quads
+        Uint64 primitivePixels = 0;     ///< Area of filled primitives
+        float flipMs = 0.0f;            ///< Time spent in Graph::flip() (includes vsync wait)
+
+        /// Sprite pixels per screen pixel
+        double overdraw(int screenW, int screenH) const
+        {
+            return (double)spritePixels / ((double)screenW * screenH);
+        }
+    };
+
+    /**
+     * @brief Aggregate over the recorded history
+     */
+    struct Summary
+    {
+        size_t frames = 0;
+        Frame mean;         ///< Mean of each counter (rounded)
+        Frame peak;         ///< Maximum of each counter
+    };
+
+    RenderStats();
+
+    // Current frame, fed by Graph while drawing
+    void countTexture(SDL_Texture* texture, bool switched);
+    void countQuad(int w, int h)
+    {
+        current.quads++;
+        if (w > 0 && h > 0)
+            current.spritePixels += (Uint64)w * (Uint64)h;
+    }
+    void countDrawCall() { current.drawCalls++; }
+    void countPrimitive(Uint32 calls = 1, Uint64 pixels = 0)
+    {
+        current.primitives += calls;
+        current.primitivePixels += pixels;
+    }
+
+    /**
+     * @brief Close the current frame and store it in the history
+     */
+    void endFrame(float flipMs);
+
+    /**
+     * @brief Forget the recorded history (the frame counter keeps running)
+     */
+    void clear();
+
+    /// Last completed frame (all zero before the first flip)
+    const Frame& last() const { return lastFrame; }
+
+    /// Number of frames in the history
+    size_t size() const { return count; }
+
+    /// History frame i, oldest first (i < size())
+    const Frame& at(size_t i) const { return history[(head + HISTORY_FRAMES - count + i) % HISTORY_FRAMES]; }
+
+    Summary summarize() const;
+
+    /**
+     * @brief Write the history as CSV, one row per frame, oldest first
+     * @return false if the file could not be written
+     */
+    bool writeCsv(const std::string& path, int screenW, int screenH) const;
+
+private:
+    Frame current;
+    Frame lastFrame;
+    std::vector<SDL_Texture*> frameTextures;    ///< Distinct textures of the current frame
+    std::vector<Frame> history;                 ///< Ring buffer of HISTORY_FRAMES entries
+    size_t head;                                ///< Next slot to write
+    size_t count;                               ///< Valid entries
+    Uint64 frameNumber;
+};
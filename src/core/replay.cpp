@@ -0,0 +1,317 @@
+#pragma warning(push)
+#pragma warning(disable: 4996)
+
+#include "replay.h"
+#include "appdata.h"
+#include "logger.h"
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    void writeU16(FILE* fp, Uint16 v)
+    {
+        unsigned char b[2] = { (unsigned char)(v & 0xFF), (unsigned char)(v >> 8) };
+        std::fwrite(b, 1, 2, fp);
+    }
+
+    void writeU32(FILE* fp, Uint32 v)
+    {
+        writeU16(fp, (Uint16)(v & 0xFFFF));
+        writeU16(fp, (Uint16)(v >> 16));
+    }
+
+    bool readU16(FILE* fp, Uint16& v)
+    {
+        unsigned char b[2];
+        if (std::fread(b, 1, 2, fp) != 2) return false;
+        v = (Uint16)(b[0] | (b[1] << 8));
+        return true;
+    }
+
+    bool readU32(FILE* fp, Uint32& v)
+    {
+        Uint16 lo, hi;
+        if (!readU16(fp, lo) || !readU16(fp, hi)) return false;
+        v = (Uint32)lo | ((Uint32)hi << 16);
+        return true;
+    }
+}
+
+Replay::Replay()
+    : mode(Mode::Idle), stage(0), seed(0), numPlayers(1), recordHashes(false),
+      cursor(0), divergedTick(-1)
+{
+}
+
+void Replay::armRecording(const std::string& file)
+{
+    stop();
+    path = file;
+    mode = Mode::Armed;
+    LOG_INFO("Replay: recording armed (%s), starts with the next stage", path.c_str());
+}
+
+bool Replay::loadPlayback(const std::string& file)
+{
+    stop();
+    if (!load(file))
+        return false;
+
+    path = file;
+    cursor = 0;
+    divergedTick = -1;
+    mode = Mode::Playing;
+    LOG_INFO("Replay: loaded %s (stage %d, seed %u, %d player(s), %d ticks%s)",
+             path.c_str(), stage, seed, numPlayers, (int)masks.size(),
+             hashes.empty() ? "" : ", with world hashes");
+    return true;
+}
+
+void Replay::stop()
+{
+    if (mode == Mode::Recording)
+    {
+        if (save())
+            LOG_SUCCESS("Replay: saved %d ticks to %s", (int)masks.size(), path.c_str());
+        else
+            LOG_ERROR("Replay: failed to write %s", path.c_str());
+    }
+    else if (mode == Mode::Playing)
+    {
+        AppData::instance().input.setInjecting(false);
+    }
+
+    mode = Mode::Idle;
+}
+
+void Replay::onSceneStart(int stageNum, Uint32 gameSeed, int players)
+{
+    if (mode == Mode::Armed)
+    {
+        stage = stageNum;
+        seed = gameSeed;
+        numPlayers = players;
+        masks.clear();
+        hashes.clear();
+        mode = Mode::Recording;
+        LOG_INFO("Replay: recording stage %d (seed %u)", stage, seed);
+    }
+    else if (mode == Mode::Playing)
+    {
+        if (stageNum != stage || gameSeed != seed || players != numPlayers)
+        {
+            LOG_WARNING("Replay: scene (stage %d, seed %u, %d player(s)) does not match the replay "
+                        "(stage %d, seed %u, %d player(s)); playback will diverge",
+                        stageNum, gameSeed, players, stage, seed, numPlayers);
+        }
+        cursor = 0;
+        divergedTick = -1;
+        AppData::instance().input.setInjecting(true);
+    }
+}
+
+void Replay::onTick()
+{
+    if (mode == Mode::Recording)
+    {
+        masks.push_back(sampleKeys(numPlayers));
+    }
+    else if (mode == Mode::Playing)
+    {
+        // Past the end, keep injecting "no keys" so the stage stays deterministic
+        Uint16 mask = cursor < (int)masks.size() ? masks[cursor] : 0;
+        injectKeys(mask, numPlayers);
+        cursor++;
+
+        if (cursor == (int)masks.size())
+        {
+            if (hashes.empty())
+                LOG_INFO("Replay: playback finished (%d ticks)", cursor);
+            else if (divergedTick < 0)
+                LOG_SUCCESS("Replay: playback finished, all %d ticks match", cursor);
+            else
+                LOG_ERROR("Replay: playback finished, diverged at tick %d", divergedTick);
+        }
+    }
+}
+
+void Replay::onTickEnd(const WorldHash& hash)
+{
+    if (mode == Mode::Recording)
+    {
+        if (recordHashes)
+            hashes.push_back(hash);
+        return;
+    }
+
+    if (mode != Mode::Playing || divergedTick >= 0)
+        return;
+
+    // cursor was advanced by onTick(), so this tick is cursor - 1
+    int tick = cursor - 1;
+    if (tick < 0 || tick >= (int)hashes.size())
+        return;
+
+    const WorldHash& expected = hashes[tick];
+    if (hash == expected)
+        return;
+
+    divergedTick = tick;
+    for (int p = 0; p < WorldHash::PART_COUNT; p++)
+    {
+        if (hash.parts[p] != expected.parts[p])
+        {
+            LOG_ERROR("Replay: diverged at tick %d: %s differ (expected %08X, got %08X)",
+                      tick, WorldHash::partName(p), expected.parts[p], hash.parts[p]);
+        }
+    }
+}
+
+void Replay::onSceneEnd()
+{
+    if (mode == Mode::Recording || mode == Mode::Playing)
+        stop();
+}
+
+Uint16 Replay::sampleKeys(int players)
+{
+    AppData& appData = AppData::instance();
+    Uint16 mask = 0;
+
+    for (int p = 0; p < players; p++)
+    {
+        Keys& keys = appData.getKeys(p);
+        int base = p * KEYS_PER_PLAYER;
+        if (appData.input.key(keys.getLeft()))  mask |= 1 << (base + KEY_LEFT);
+        if (appData.input.key(keys.getRight())) mask |= 1 << (base + KEY_RIGHT);
+        if (appData.input.key(keys.getShoot())) mask |= 1 << (base + KEY_SHOOT);
+        if (appData.input.key(keys.getUp()))    mask |= 1 << (base + KEY_UP);
+        if (appData.input.key(keys.getDown()))  mask |= 1 << (base + KEY_DOWN);
+    }
+
+    return mask;
+}
+
+void Replay::injectKeys(Uint16 mask, int players)
+{
+    AppData& appData = AppData::instance();
+    MInput& input = appData.input;
+
+    input.clearInjectedKeys();
+    for (int p = 0; p < players; p++)
+    {
+        Keys& keys = appData.getKeys(p);
+        int base = p * KEYS_PER_PLAYER;
+        input.setInjectedKey(keys.getLeft(),  (mask >> (base + KEY_LEFT)) & 1);
+        input.setInjectedKey(keys.getRight(), (mask >> (base + KEY_RIGHT)) & 1);
+        input.setInjectedKey(keys.getShoot(), (mask >> (base + KEY_SHOOT)) & 1);
+        input.setInjectedKey(keys.getUp(),    (mask >> (base + KEY_UP)) & 1);
+        input.setInjectedKey(keys.getDown(),  (mask >> (base + KEY_DOWN)) & 1);
+    }
+}
+
+bool Replay::save() const
+{
+    FILE* fp = fopen(path.c_str(), "wb");
+    if (!fp)
+        return false;
+
+    // Run-length encode the mask stream (held keys produce long runs)
+    std::vector<std::pair<Uint16, Uint16>> runs;
+    for (Uint16 mask : masks)
+    {
+        if (!runs.empty() && runs.back().first == mask && runs.back().second < 0xFFFF)
+            runs.back().second++;
+        else
+            runs.push_back({ mask, (Uint16)1 });
+    }
+
+    bool withHashes = !hashes.empty() && hashes.size() == masks.size();
+
+    std::fwrite("BRPL", 1, 4, fp);
+    writeU16(fp, VERSION);
+    writeU16(fp, withHashes ? FLAG_HASHES : 0);
+    writeU32(fp, (Uint32)stage);
+    writeU32(fp, seed);
+    writeU32(fp, (Uint32)numPlayers);
+    writeU32(fp, (Uint32)masks.size());
+    writeU32(fp, (Uint32)runs.size());
+    for (const auto& run : runs)
+    {
+        writeU16(fp, run.first);
+        writeU16(fp, run.second);
+    }
+
+    if (withHashes)
+    {
+        for (const WorldHash& hash : hashes)
+        {
+            for (int p = 0; p < WorldHash::PART_COUNT; p++)
+                writeU32(fp, hash.parts[p]);
+        }
+    }
+
+    bool ok = !std::ferror(fp);
+    fclose(fp);
+    return ok;
+}
+
+bool Replay::load(const std::string& file)
+{
+    FILE* fp = fopen(file.c_str(), "rb");
+    if (!fp)
+    {
+        LOG_ERROR("Replay: cannot open %s", file.c_str());
+        return false;
+    }
+
+    char magic[4];
+    Uint16 version = 0, flags = 0;
+    Uint32 stg = 0, sd = 0, players = 0, ticks = 0, runCount = 0;
+    bool ok = std::fread(magic, 1, 4, fp) == 4 && std::memcmp(magic, "BRPL", 4) == 0 &&
+              readU16(fp, version) && version == VERSION && readU16(fp, flags) &&
+              readU32(fp, stg) && readU32(fp, sd) && readU32(fp, players) &&
+              readU32(fp, ticks) && readU32(fp, runCount) &&
+              players >= 1 && players <= 2;
+
+    std::vector<Uint16> data;
+    if (ok)
+    {
+        data.reserve(ticks);
+        for (Uint32 i = 0; i < runCount && ok; i++)
+        {
+            Uint16 mask, length;
+            ok = readU16(fp, mask) && readU16(fp, length);
+            if (ok) data.insert(data.end(), length, mask);
+        }
+        ok = ok && data.size() == ticks;
+    }
+
+    std::vector<WorldHash> hashData;
+    if (ok && (flags & FLAG_HASHES))
+    {
+        hashData.resize(ticks);
+        for (Uint32 i = 0; i < ticks && ok; i++)
+        {
+            for (int p = 0; p < WorldHash::PART_COUNT && ok; p++)
+                ok = readU32(fp, hashData[i].parts[p]);
+        }
+    }
+    fclose(fp);
+
+    if (!ok)
+    {
+        LOG_ERROR("Replay: %s is not a valid replay file", file.c_str());
+        return false;
+    }
+
+    stage = (int)stg;
+    seed = sd;
+    numPlayers = (int)players;
+    masks.swap(data);
+    hashes.swap(hashData);
+    return true;
+}
+
+#pragma warning(pop)
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "worldhash.h"
+
+/**
+ * Replay class
+ *
+ * Records the per-tick gameplay key state of one stage and plays it back
+ * by injecting the keys into MInput instead of the SDL keyboard state.
+ *
+ * A replay covers a single Scene, from Scene::init() to Scene::release().
+ * Together with the stage number, player count and game seed stored in the
+ * header, that is enough to re-simulate the stage exactly: the Scene's
+ * random generator is derived from the seed, and the simulation always
+ * advances in fixed 1/60 s steps.
+ *
+ * Per tick, the five mapped keys of each player (left, right, shoot, up,
+ * down) are packed into a 16-bit mask, sampled through MInput::key() so
+ * that the recording sees exactly what the game saw (e.g. no keys while
+ * the console is open).
+ *
+ * Optionally (setRecordHashes), the WorldHash after every tick is stored
+ * as well. Playing such a file back compares the re-simulated state tick
+ * by tick and reports the first tick and entity category that diverge.
+ *
+ * File format (little-endian):
+ *   "BRPL" magic, u16 version, u16 flags (bit 0: hashes present),
+ *   u32 stage, u32 seed, u32 numPlayers, u32 tickCount, u32 runCount,
+ *   runCount x { u16 mask, u16 length }   (run-length encoded masks)
+ *   [tickCount x WorldHash::PART_COUNT x u32]   (if flags bit 0)
+ *
+ * Usage:
+ *   replay.armRecording("run.rpl");        // records the next stage played
+ *   replay.loadPlayback("run.rpl");        // then start its stage with its seed
+ *   // Scene calls onSceneStart / onTick / onTickEnd / onSceneEnd
+ */
+class Replay
+{
+public:
+    enum class Mode
+    {
+        Idle,       ///< Not recording or playing
+        Armed,      ///< Recording will start at the next Scene::init()
+        Recording,  ///< Sampling keys every tick
+        Playing     ///< Injecting keys every tick
+    };
+
+    // Key bits within a player's 5-bit group
+    static constexpr int KEY_LEFT = 0;
+    static constexpr int KEY_RIGHT = 1;
+    static constexpr int KEY_SHOOT = 2;
+    static constexpr int KEY_UP = 3;
+    static constexpr int KEY_DOWN = 4;
+    static constexpr int KEYS_PER_PLAYER = 5;
+
+    Replay();
+
+    /**
+     * Arm recording: the next Scene started is recorded and written to path
+     * when it ends.
+     */
+    void armRecording(const std::string& path);
+
+    /**
+     * Load a replay file and switch to playback mode
+     * @return false if the file is missing or malformed
+     */
+    bool loadPlayback(const std::string& path);
+
+    /**
+     * Stop recording or playback. A recording in progress is saved.
+     */
+    void stop();
+
+    /**
+     * Store a WorldHash per tick in recordings (set before recording starts)
+     */
+    void setRecordHashes(bool enabled) { recordHashes = enabled; }
+
+    // Scene hooks
+    void onSceneStart(int stage, Uint32 seed, int numPlayers);
+    void onTick();
+    void onTickEnd(const WorldHash& hash);
+    void onSceneEnd();
+
+    /** True if the Scene should compute a WorldHash after this tick */
+    bool wantsWorldHash() const
+    {
+        return (mode == Mode::Recording && recordHashes) ||
+               (mode == Mode::Playing && cursor <= (int)hashes.size());
+    }
+
+    Mode getMode() const { return mode; }
+    bool isPlaying() const { return mode == Mode::Playing; }
+    bool isRecording() const { return mode == Mode::Recording; }
+
+    /** True once playback has injected every recorded tick */
+    bool isPlaybackFinished() const { return mode == Mode::Playing && cursor >= (int)masks.size(); }
+
+    bool hasHashes() const { return !hashes.empty(); }
+    /** First tick (0-based) whose WorldHash differed during playback, or -1 */
+    int getDivergedTick() const { return divergedTick; }
+
+    int getStage() const { return stage; }
+    Uint32 getSeed() const { return seed; }
+    int getNumPlayers() const { return numPlayers; }
+    int getTickCount() const { return (int)masks.size(); }
+    int getCursor() const { return cursor; }
+
+private:
+    static constexpr Uint16 VERSION = 1;
+    static constexpr Uint16 FLAG_HASHES = 1;
+
+    Mode mode;
+    std::string path;           ///< File being recorded to / played from
+    int stage;                  ///< Stage number (1-based)
+    Uint32 seed;                ///< AppData::gameSeed at stage start
+    int numPlayers;
+    std::vector<Uint16> masks;      ///< One key mask per tick
+    std::vector<WorldHash> hashes;  ///< World state after each tick (optional)
+    bool recordHashes;              ///< Store hashes in the next recording
+    int cursor;                     ///< Ticks injected so far during playback
+    int divergedTick;               ///< First mismatching tick in playback (-1 = none)
+
+    static Uint16 sampleKeys(int numPlayers);
+    static void injectKeys(Uint16 mask, int numPlayers);
+
+    bool save() const;
+    bool load(const std::string& file);
+};
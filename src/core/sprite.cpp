@@ -34,6 +34,7 @@ void Sprite::init(SDL_Texture* sharedTexture, int x, int y, int w, int h, int of
     yoff = offy;
     sourceW = 0;  // Not set (will use trimmed size)
     sourceH = 0;
+    ownsBmp = false;
     graph = nullptr;  // No Graph needed for shared texture
 }
 
@@ -53,12 +54,25 @@ void Sprite::init(SDL_Texture* sharedTexture, int x, int y, int w, int h, int of
     yoff = offy;
     sourceW = srcW;
     sourceH = srcH;
+    ownsBmp = false;
     graph = nullptr;
 }
 
+void Sprite::relocate(SDL_Texture* texture, int x, int y) {
+    bmp = texture;
+    srcX = x;
+    srcY = y;
+    ownsBmp = false;
+}
+
+/**
+ * Destroys the texture if this sprite loaded it. Sprites referencing a
+ * shared texture (sprite sheet frames, atlas regions) only drop the reference.
+ */
 void Sprite::release() {
-    if (bmp != nullptr) {
+    if (bmp != nullptr && ownsBmp) {
         SDL_DestroyTexture(bmp);
-        bmp = nullptr;
     }
+    bmp = nullptr;
+    ownsBmp = false;
 }
\ No newline at end of file
@@ -26,10 +26,12 @@ private:
     int srcX, srcY;      // Source position in texture (for sprite sheets)
     int xoff, yoff;      // Relative displacement (from Aseprite spriteSourceSize)
     int sourceW, sourceH; // Original canvas size (from Aseprite sourceSize, 0 if not set)
+    bool ownsBmp;        // bmp was loaded for this sprite (destroyed by release())
     Graph* graph;
 
 public:
-    Sprite() : bmp(nullptr), sx(0), sy(0), srcX(0), srcY(0), xoff(0), yoff(0), sourceW(0), sourceH(0), graph(nullptr) {}
+    Sprite() : bmp(nullptr), sx(0), sy(0), srcX(0), srcY(0), xoff(0), yoff(0), sourceW(0), sourceH(0),
+               ownsBmp(false), graph(nullptr) {}
 
     void init(Graph* gr, const std::string& file, int offx = 0, int offy = 0);
     void init(SDL_Texture* sharedTexture, int x, int y, int w, int h, int offx, int offy);
@@ -55,6 +57,13 @@ public:
     void setOffset(int offx, int offy) { xoff = offx; yoff = offy; }
     void setSourceSize(int w, int h) { sourceW = w; sourceH = h; }
 
+    /**
+     * Point the sprite at a region of another texture (e.g. a TextureAtlas page).
+     * Size and offsets are kept; the sprite does not own the new texture, and
+     * the caller takes over the old one if the sprite owned it.
+     */
+    void relocate(SDL_Texture* texture, int x, int y);
+
     // Temporary friend class or public access until refactoring is complete
     friend class Graph;
     friend class Floor;
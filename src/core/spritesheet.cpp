@@ -63,6 +63,13 @@ void SpriteSheet::release()
     frames.clear();
 }
 
+SDL_Texture* SpriteSheet::detachTexture()
+{
+    SDL_Texture* detached = texture;
+    texture = nullptr;
+    return detached;
+}
+
 Sprite* SpriteSheet::getFrame(int index)
 {
     if (index >= 0 && index < static_cast<int>(frames.size()))
@@ -70,6 +70,13 @@ public:
      */
     void release();
 
+    /**
+     * Give up ownership of the texture, keeping the frames (used once the
+     * frames have been relocated into a TextureAtlas)
+     * @return The texture, now owned by the caller
+     */
+    SDL_Texture* detachTexture();
+
     /**
      * Get the underlying SDL texture
      */
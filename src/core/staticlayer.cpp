@@ -0,0 +1,113 @@
+#include "staticlayer.h"
+#include "graph.h"
+#include "logger.h"
+
+void StaticLayer::invalidate(const SDL_Rect& area)
+{
+    if (fullDirty)
+        return;
+
+    SDL_Rect screen = { 0, 0, RES_X, RES_Y };
+    SDL_Rect clipped;
+    if (!SDL_IntersectRect(&area, &screen, &clipped))
+        return;
+
+    // Grow an overlapping region instead of redrawing the overlap twice
+    for (SDL_Rect& region : dirtyRegions)
+    {
+        if (SDL_HasIntersection(&region, &clipped))
+        {
+            SDL_UnionRect(&region, &clipped, &region);
+            return;
+        }
+    }
+
+    if (dirtyRegions.size() >= MAX_DIRTY_REGIONS)
+    {
+        invalidate();
+        return;
+    }
+    dirtyRegions.push_back(clipped);
+}
+
+void StaticLayer::redrawRegion(Graph& graph, const SDL_Rect& area, const std::function<void()>& redraw)
+{
+    SDL_Renderer* renderer = graph.getRenderer();
+
+    SDL_RenderSetClipRect(renderer, &area);
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderFillRect(renderer, &area);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+
+    graph.beginBatch();
+    redraw();
+    graph.endBatch();
+
+    SDL_RenderSetClipRect(renderer, nullptr);
+    stats.pixelsRedrawn += (Uint64)area.w * (Uint64)area.h;
+}
+
+bool StaticLayer::draw(Graph& graph, const std::function<void()>& redraw)
+{
+    if (unsupported)
+        return false;
+
+    SDL_Renderer* renderer = graph.getRenderer();
+    if (!texture)
+    {
+        if (renderer && SDL_RenderTargetSupported(renderer))
+            texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, RES_X, RES_Y);
+        if (!texture)
+        {
+            LOG_WARNING("StaticLayer: no render target available (%s), drawing static content every frame", SDL_GetError());
+            unsupported = true;
+            return false;
+        }
+        // Opaque: the blit replaces whatever the previous frame left
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        invalidate();
+    }
+
+    if (isDirty())
+    {
+        // Queued draws belong to the screen, not to the cache
+        graph.flushBatch();
+
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, texture);
+
+        if (fullDirty)
+        {
+            SDL_Rect all = { 0, 0, RES_X, RES_Y };
+            redrawRegion(graph, all, redraw);
+            stats.fullRedraws++;
+        }
+        else
+        {
+            for (const SDL_Rect& region : dirtyRegions)
+                redrawRegion(graph, region, redraw);
+            stats.regionRedraws += dirtyRegions.size();
+        }
+
+        SDL_SetRenderTarget(renderer, previousTarget);
+        fullDirty = false;
+        dirtyRegions.clear();
+    }
+
+    SDL_Rect all = { 0, 0, RES_X, RES_Y };
+    graph.draw(texture, &all, 0, 0);
+    stats.blits++;
+    return true;
+}
+
+void StaticLayer::release()
+{
+    if (texture)
+    {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    invalidate();
+}
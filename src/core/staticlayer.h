@@ -0,0 +1,92 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <SDL.h>
+
+class Graph;
+
+/**
+ * StaticLayer class
+ *
+ * Screen-sized render target caching content that rarely changes
+ * (background, platforms, ladders). Each frame the cache is
+ * drawn with a single blit; the content is only redrawn where it was
+ * invalidated.
+ *
+ * The owner reports changes with invalidate(area) (a platform revealed,
+ * starting to break or removed) or invalidate() (new geometry, new stage).
+ * draw() then redraws each dirty region through the owner's callback with
+ * the clip rectangle set to that region, so the callback can simply draw
+ * all static content. Overlapping regions are merged; past
+ * MAX_DIRTY_REGIONS the whole layer is redrawn instead.
+ *
+ * The cache is opaque: dirty regions are cleared to black before the
+ * callback draws into them. If the renderer has no render target support
+ * draw() returns false and the owner draws the content directly.
+ */
+class StaticLayer
+{
+public:
+    static constexpr size_t MAX_DIRTY_REGIONS = 16;
+
+    /**
+     * @brief Redraw counters since creation
+     */
+    struct Stats
+    {
+        Uint64 blits = 0;           ///< Frames drawn from the cache
+        Uint64 fullRedraws = 0;     ///< Whole-layer redraws
+        Uint64 regionRedraws = 0;   ///< Partial redraws (one per dirty region)
+        Uint64 pixelsRedrawn = 0;   ///< Area of all redraws
+    };
+
+    StaticLayer() = default;
+    ~StaticLayer() { release(); }
+
+    StaticLayer(const StaticLayer&) = delete;
+    StaticLayer& operator=(const StaticLayer&) = delete;
+
+    /**
+     * @brief Mark the whole layer for redraw
+     */
+    void invalidate()
+    {
+        fullDirty = true;
+        dirtyRegions.clear();
+    }
+
+    /**
+     * @brief Mark a screen area for redraw (clipped to the screen)
+     */
+    void invalidate(const SDL_Rect& area);
+
+    bool isDirty() const { return fullDirty || !dirtyRegions.empty(); }
+
+    /**
+     * @brief Redraw the dirty regions, then blit the cache to the screen
+     *
+     * @param graph Graphics context (the blit goes through its render queue)
+     * @param redraw Draws all static content; called once per dirty region
+     *        with the render target and clip rectangle already set
+     * @return false if the cache is unavailable (nothing was drawn)
+     */
+    bool draw(Graph& graph, const std::function<void()>& redraw);
+
+    /**
+     * @brief Destroy the cache texture (recreated and fully redrawn by the next draw())
+     */
+    void release();
+
+    bool isCreated() const { return texture != nullptr; }
+    const Stats& getStats() const { return stats; }
+
+private:
+    void redrawRegion(Graph& graph, const SDL_Rect& area, const std::function<void()>& redraw);
+
+    SDL_Texture* texture = nullptr;
+    bool fullDirty = true;
+    bool unsupported = false;           ///< Creation failed once: stop retrying
+    std::vector<SDL_Rect> dirtyRegions;
+    Stats stats;
+};
@@ -0,0 +1,273 @@
+#include "textureatlas.h"
+#include "graph.h"
+#include "sprite.h"
+#include "spritesheet.h"
+#include "logger.h"
+#include <algorithm>
+#include <map>
+#include <set>
+#include <tuple>
+
+void TextureAtlas::add(Sprite* sprite)
+{
+    if (sprite)
+        sprites.push_back(sprite);
+}
+
+void TextureAtlas::add(SpriteSheet* sheet)
+{
+    if (sheet)
+        sheets.push_back(sheet);
+}
+
+std::vector<SDL_Point> TextureAtlas::pack(int pageSize)
+{
+    std::vector<size_t> order(regions.size());
+    for (size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+
+    // Tallest first keeps shelves tight; ties by width for a stable layout
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b)
+    {
+        const SDL_Rect& ra = regions[a].rect;
+        const SDL_Rect& rb = regions[b].rect;
+        return ra.h != rb.h ? ra.h > rb.h : ra.w > rb.w;
+    });
+
+    std::vector<SDL_Point> sizes;
+    int x = 0, y = 0, shelfH = 0;
+    for (size_t i : order)
+    {
+        Region& region = regions[i];
+        int w = region.rect.w + PADDING;
+        int h = region.rect.h + PADDING;
+        if (w > pageSize || h > pageSize)
+            continue;   // Stays in its own texture
+
+        if (sizes.empty())
+            sizes.push_back({ 0, 0 });
+
+        if (x + w > pageSize)
+        {
+            // Next shelf
+            y += shelfH;
+            x = 0;
+            shelfH = 0;
+        }
+        if (y + h > pageSize)
+        {
+            // Next page
+            sizes.push_back({ 0, 0 });
+            x = y = shelfH = 0;
+        }
+
+        region.page = (int)sizes.size() - 1;
+        region.x = x;
+        region.y = y;
+
+        SDL_Point& size = sizes.back();
+        size.x = std::max(size.x, x + region.rect.w);
+        size.y = std::max(size.y, y + region.rect.h);
+
+        x += w;
+        shelfH = std::max(shelfH, h);
+    }
+    return sizes;
+}
+
+SDL_Texture* TextureAtlas::renderPage(Graph* graph, int page, const SDL_Point& size)
+{
+    SDL_Renderer* renderer = graph->getRenderer();
+
+    SDL_Texture* target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                            SDL_TEXTUREACCESS_TARGET, size.x, size.y);
+    SDL_Surface* pixels = SDL_CreateRGBSurfaceWithFormat(0, size.x, size.y, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!target || !pixels)
+    {
+        LOG_WARNING("TextureAtlas: cannot create %dx%d page: %s", size.x, size.y, SDL_GetError());
+        if (target) SDL_DestroyTexture(target);
+        if (pixels) SDL_FreeSurface(pixels);
+        return nullptr;
+    }
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+
+    SDL_SetRenderTarget(renderer, target);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    for (const Region& region : regions)
+    {
+        if (region.page != page)
+            continue;
+
+        // Copy the pixels verbatim (alpha included) instead of blending them
+        SDL_BlendMode blend;
+        SDL_GetTextureBlendMode(region.source, &blend);
+        SDL_SetTextureBlendMode(region.source, SDL_BLENDMODE_NONE);
+        SDL_Rect dst = { region.x, region.y, region.rect.w, region.rect.h };
+        SDL_RenderCopy(renderer, region.source, &region.rect, &dst);
+        SDL_SetTextureBlendMode(region.source, blend);
+    }
+
+    // Read back into a static texture: render targets can be lost on device reset
+    SDL_Rect all = { 0, 0, size.x, size.y };
+    bool read = SDL_RenderReadPixels(renderer, &all, SDL_PIXELFORMAT_ARGB8888,
+                                     pixels->pixels, pixels->pitch) == 0;
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    SDL_DestroyTexture(target);
+
+    SDL_Texture* texture = read ? SDL_CreateTextureFromSurface(renderer, pixels) : nullptr;
+    SDL_FreeSurface(pixels);
+
+    if (!texture)
+    {
+        LOG_WARNING("TextureAtlas: cannot build page %d: %s", page, SDL_GetError());
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
+bool TextureAtlas::build(Graph* graph, int pageSize)
+{
+    if (isBuilt())
+    {
+        LOG_WARNING("TextureAtlas: already built");
+        return false;
+    }
+
+    SDL_Renderer* renderer = graph->getRenderer();
+    if (!renderer || !SDL_RenderTargetSupported(renderer))
+    {
+        LOG_WARNING("TextureAtlas: renderer has no render target support, sprites keep their textures");
+        return false;
+    }
+
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) == 0)
+    {
+        if (info.max_texture_width > 0) pageSize = std::min(pageSize, info.max_texture_width);
+        if (info.max_texture_height > 0) pageSize = std::min(pageSize, info.max_texture_height);
+    }
+
+    // Collect the distinct regions and the sprites drawing each of them
+    std::vector<Sprite*> all = sprites;
+    for (SpriteSheet* sheet : sheets)
+    {
+        for (int i = 0; i < sheet->getFrameCount(); i++)
+            all.push_back(sheet->getFrame(i));
+    }
+
+    stats = Stats();
+    std::map<std::tuple<SDL_Texture*, int, int, int, int>, size_t> lookup;
+    std::set<SDL_Texture*> sources;
+    for (Sprite* spr : all)
+    {
+        if (!spr->getBmp() || spr->getWidth() <= 0 || spr->getHeight() <= 0)
+            continue;
+
+        auto key = std::make_tuple(spr->getBmp(), spr->getSrcX(), spr->getSrcY(), spr->getWidth(), spr->getHeight());
+        auto it = lookup.find(key);
+        if (it == lookup.end())
+        {
+            Region region;
+            region.source = spr->getBmp();
+            region.rect = { spr->getSrcX(), spr->getSrcY(), spr->getWidth(), spr->getHeight() };
+            it = lookup.emplace(key, regions.size()).first;
+            regions.push_back(region);
+            sources.insert(region.source);
+        }
+        regions[it->second].sprites.push_back(spr);
+    }
+    stats.sourceTextures = (int)sources.size();
+
+    std::vector<SDL_Point> sizes = pack(pageSize);
+    for (size_t p = 0; p < sizes.size(); p++)
+    {
+        SDL_Texture* page = renderPage(graph, (int)p, sizes[p]);
+        pages.push_back(page);
+        if (!page)
+        {
+            for (Region& region : regions)
+            {
+                if (region.page == (int)p)
+                    region.page = -1;
+            }
+        }
+    }
+
+    // Relocate; a source texture can only go once none of its regions stayed behind
+    std::set<SDL_Texture*> kept;
+    long long packedArea = 0;
+    for (const Region& region : regions)
+    {
+        if (region.page < 0)
+        {
+            kept.insert(region.source);
+            stats.skipped++;
+            continue;
+        }
+
+        for (Sprite* spr : region.sprites)
+            spr->relocate(pages[region.page], region.x, region.y);
+        packedArea += (long long)region.rect.w * region.rect.h;
+        stats.regions++;
+        stats.sprites += (int)region.sprites.size();
+    }
+
+    std::set<SDL_Texture*> retired;
+    for (SDL_Texture* source : sources)
+    {
+        if (!kept.count(source))
+            retired.insert(source);
+    }
+    for (SpriteSheet* sheet : sheets)
+    {
+        if (retired.count(sheet->getTexture()))
+            sheet->detachTexture();
+    }
+    for (SDL_Texture* source : retired)
+        SDL_DestroyTexture(source);
+
+    std::set<SDL_Texture*> after;
+    for (const Region& region : regions)
+        after.insert(region.page >= 0 ? pages[region.page] : region.source);
+
+    long long pageArea = 0;
+    for (size_t p = 0; p < sizes.size(); p++)
+    {
+        if (pages[p])
+            pageArea += (long long)sizes[p].x * sizes[p].y;
+    }
+
+    // Drop failed pages so pages only holds live textures
+    pages.erase(std::remove(pages.begin(), pages.end(), nullptr), pages.end());
+
+    stats.pages = (int)pages.size();
+    stats.texturesAfter = (int)after.size();
+    stats.fill = pageArea > 0 ? (double)packedArea / (double)pageArea : 0.0;
+
+    regions.clear();
+    sprites.clear();
+    sheets.clear();
+
+    if (stats.regions == 0)
+        return false;
+
+    LOG_INFO("TextureAtlas: %d sprites (%d regions) from %d textures packed into %d page(s), %.0f%% filled; %d textures in use (was %d)",
+             stats.sprites, stats.regions, stats.sourceTextures, stats.pages, stats.fill * 100.0,
+             stats.texturesAfter, stats.sourceTextures);
+    return true;
+}
+
+void TextureAtlas::release()
+{
+    for (SDL_Texture* page : pages)
+        SDL_DestroyTexture(page);
+    pages.clear();
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+class Graph;
+class Sprite;
+class SpriteSheet;
+
+/**
+ * TextureAtlas class
+ *
+ * Packs many small textures into a few large pages at startup, so that
+ * drawing a frame full of balls, platforms, shots and HUD sprites no
+ * longer switches textures for every sprite.
+ *
+ * Sprites and sprite sheets are registered with add() after they have been
+ * loaded. build() copies every registered region into the pages (on the
+ * GPU, then read back into static textures so they survive render target
+ * resets) and relocates each Sprite to its new region with
+ * Sprite::relocate(). Width, height and offsets are untouched, so Aseprite
+ * trimming keeps working and Graph::draw/drawEx need no changes. The
+ * original textures are destroyed.
+ *
+ * Only the trimmed frame rectangles are packed; identical regions shared
+ * by several sprites are stored once. Regions larger than a page are left
+ * in their own texture.
+ *
+ * The atlas owns its pages: call release() when the relocated sprites are
+ * no longer drawn.
+ */
+class TextureAtlas
+{
+public:
+    static constexpr int DEFAULT_PAGE_SIZE = 2048;
+    static constexpr int PADDING = 1;   ///< Transparent gap between regions (no bleeding when scaled)
+
+    /**
+     * @brief Packing statistics of the last build()
+     */
+    struct Stats
+    {
+        int sourceTextures = 0;     ///< Distinct textures referenced before packing
+        int pages = 0;              ///< Atlas pages created
+        int regions = 0;            ///< Distinct regions packed
+        int sprites = 0;            ///< Sprites relocated into the atlas
+        int skipped = 0;            ///< Regions left in their own texture (too large)
+        int texturesAfter = 0;      ///< Distinct textures referenced after packing
+        double fill = 0.0;          ///< Packed area / page area (0..1)
+    };
+
+    TextureAtlas() = default;
+    ~TextureAtlas() { release(); }
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /**
+     * @brief Register a sprite (its whole region) for packing
+     */
+    void add(Sprite* sprite);
+
+    /**
+     * @brief Register all frames of a sprite sheet for packing
+     */
+    void add(SpriteSheet* sheet);
+
+    /**
+     * @brief Pack all registered sprites and relocate them into the pages
+     * @param graph Renderer owner (must support render targets)
+     * @param pageSize Maximum page width/height (clamped to the renderer's limit)
+     * @return false if nothing was packed (sprites keep their textures)
+     */
+    bool build(Graph* graph, int pageSize = DEFAULT_PAGE_SIZE);
+
+    /**
+     * @brief Destroy the pages (relocated sprites must not be drawn afterwards)
+     */
+    void release();
+
+    bool isBuilt() const { return !pages.empty(); }
+    const Stats& getStats() const { return stats; }
+
+private:
+    /// A distinct source rectangle and every sprite that draws it
+    struct Region
+    {
+        SDL_Texture* source;
+        SDL_Rect rect;
+        std::vector<Sprite*> sprites;
+        int page = -1;              ///< -1 = not packed
+        int x = 0, y = 0;           ///< Position in the page
+    };
+
+    /**
+     * @brief Shelf-pack the regions (tallest first) and return the size of each page
+     */
+    std::vector<SDL_Point> pack(int pageSize);
+    SDL_Texture* renderPage(Graph* graph, int page, const SDL_Point& size);
+
+    std::vector<Sprite*> sprites;
+    std::vector<SpriteSheet*> sheets;
+    std::vector<Region> regions;
+    std::vector<SDL_Texture*> pages;
+    Stats stats;
+};
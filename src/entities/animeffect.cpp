@@ -6,11 +6,29 @@
 #include "../core/coordhelper.h"
 
 AnimEffect::AnimEffect(int x, int y, AnimSpriteSheet* tmpl, float scaleVal)
-    : scale(scaleVal)
 {
+    reset(x, y, tmpl, scaleVal);
+}
+
+AnimEffect::~AnimEffect() = default;
+
+void AnimEffect::reset(int x, int y, AnimSpriteSheet* tmpl, float scaleVal)
+{
+    resetDead();
+    hasPrev = false;
     xPos = (float)x;
     yPos = (float)y;
+    scale = scaleVal;
+
+    // Reuse the clone when the template is the same (the common case: ball pops)
+    if (anim && source == tmpl)
+    {
+        anim->reset();
+        return;
+    }
+
     anim = tmpl->clone();
+    source = tmpl;
 
     // Effects always play once - force the underlying animation to stop after one pass.
     // FrameSequenceAnim exposes setLoops(); StateMachineAnim states are configured per-state.
@@ -27,7 +45,7 @@ void AnimEffect::update(float dt)
         kill();
 }
 
-void AnimEffect::draw(Graph* graph)
+void AnimEffect::draw(Graph* graph, float alpha)
 {
     Sprite* spr = anim->getCurrentSprite();
     if (!spr)
@@ -36,8 +54,8 @@ void AnimEffect::draw(Graph* graph)
     // Apply scale to get render position (centered)
     int scaledW = (int)(anim->getWidth() * scale);
     int scaledH = (int)(anim->getHeight() * scale);
-    int renderX = toRenderX(xPos, scaledW);
-    int renderY = toRenderY(yPos, scaledH);
+    int renderX = toRenderX(getRenderX(alpha), scaledW);
+    int renderY = toRenderY(getRenderY(alpha), scaledH);
 
     if (scale != 1.0f)
     {
@@ -14,6 +14,9 @@ class Graph;
  *
  * The x, y position is the center point of the effect. The animation sprite
  * is offset by half its frame dimensions so it renders centered.
+ *
+ * Effects live in a RecyclePool: reset() re-arms a finished effect in place
+ * and only clones the template again when it differs from the last one.
  */
 class AnimEffect : public IGameObject
 {
@@ -26,12 +29,22 @@ public:
      */
     AnimEffect(int x, int y, AnimSpriteSheet* tmpl, float scale = 1.0f);
 
+    /// Empty effect for pools; call reset() before use
+    AnimEffect() = default;
+    ~AnimEffect();
+
+    /**
+     * @brief Restart as a new effect (same parameters as the constructor)
+     */
+    void reset(int x, int y, AnimSpriteSheet* tmpl, float scale = 1.0f);
+
     void update(float dt);
-    void draw(Graph* graph);
+    void draw(Graph* graph, float alpha = 1.0f);
 
     CollisionBox getCollisionBox() const override { return {0, 0, 0, 0}; }
 
 private:
     std::unique_ptr<AnimSpriteSheet> anim;
+    const AnimSpriteSheet* source = nullptr;  ///< Template anim was cloned from
     float scale = 1.0f;  ///< Scale factor for rendering
 };
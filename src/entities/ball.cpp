@@ -1,6 +1,7 @@
 #include "main.h"
 #include "animspritesheet.h"
 #include "eventmanager.h"
+#include <algorithm>
 #include <cmath>
 #include <SDL.h>
 
@@ -21,42 +22,35 @@
  * The ball starts either moving up or down (dirY) and moving in the
  * horizontal direction (dirX).
  */
-Ball::Ball(Scene* scn, int x, int y, int size, float dx, int dy, int topVal, int colorVal)
+Ball::Ball(BallKernel& mot, Uint32 ln, Scene* scn, int x, int y, int size, float dx, int dy, int topVal, int colorVal)
+    : motion(&mot), lane(ln)
 {
     scene = scn;
-    this->xPos = (float)x;
-    this->yPos = (float)y;  // Absolute screen coordinate
     this->size = size;
     color = static_cast<Color>(colorVal);
 
-    top = topVal;
+    BallMotion m;
+    m.x = (float)x;
+    m.y = (float)y;  // Absolute screen coordinate
 
-    dirX = dx;
-    dirY = dy;
+    m.top = topVal;
 
-    // Get diameter from the ball spritesheet
-    StageResources& res = gameinf.getStageRes();
-    AnimSpriteSheet* anim = res.getBallAnim(static_cast<int>(color));
-    if (anim)
-    {
-        Sprite* spr = anim->getFrame(size);
-        diameter = spr ? spr->getWidth() : 64;  // Fallback to 64 if sprite not found
-    }
-    else
-    {
-        diameter = 64;  // Fallback
-    }
+    m.dirX = dx;
+    m.dirY = dy;
+
+    m.diameter = diameterFor(size, colorVal);
 
-    time = 0;
+    m.time = 0;
 
-    if (!top)
-        initTop();
+    if (!m.top)
+        initTop(m);
 
     // Calculate y0 as offset from baseline for physics
     // (baseline = Stage::MAX_Y - top = peak bounce height)
-    y0 = yPos - (float)(Stage::MAX_Y - top);
+    m.y0 = m.y - (float)(Stage::MAX_Y - m.top);
 
-    init();
+    init(m);
+    setMotion(m);
 }
 
 /********************************************************
@@ -76,64 +70,86 @@ Ball::Ball(Scene* scn, int x, int y, int size, float dx, int dy, int topVal, int
  * size reduced by one unit. A directional offset is applied based on the dir parameter
  * to separate the two child balls.
  */
-Ball::Ball(Scene* scn, Ball* oldball, int dir)
+Ball::Ball(BallKernel& mot, Uint32 ln, Scene* scn, Ball* oldball, int dir)
+    : motion(&mot), lane(ln)
 {
     scene = scn;
     color = oldball->color;
-    dirY = 1;
-    dirX = dir;
-    time = oldball->time;
+    BallMotion parent = oldball->getMotion();
+
+    BallMotion m;
+    m.dirY = 1;
+    m.dirX = dir;
+    m.time = parent.time;
 
     size = oldball->size + 1;
 
-    // Get diameter from the ball spritesheet
-    StageResources& res = gameinf.getStageRes();
-    AnimSpriteSheet* anim = res.getBallAnim(static_cast<int>(color));
-    if (anim)
-    {
-        Sprite* spr = anim->getFrame(size);
-        diameter = spr ? spr->getWidth() : 40;  // Fallback
-    }
-    else
-    {
-        diameter = 40;  // Fallback
-    }
+    m.diameter = diameterFor(size, static_cast<int>(color));
 
     // Calculate center of parent ball
-    float parentCenterX = oldball->xPos + (oldball->diameter / 2.0f);
-    float parentCenterY = oldball->yPos + (oldball->diameter / 2.0f);
+    float parentCenterX = parent.x + (parent.diameter / 2.0f);
+    float parentCenterY = parent.y + (parent.diameter / 2.0f);
 
     // Position new ball at parent's center (top-left positioning)
-    this->xPos = parentCenterX - (diameter / 2.0f);
-    this->yPos = parentCenterY - (diameter / 2.0f);
+    m.x = parentCenterX - (m.diameter / 2.0f);
+    m.y = parentCenterY - (m.diameter / 2.0f);
 
     // Apply directional offset proportional to diameter
-    float offset = diameter * 0.5f;
-    this->xPos += offset * dirX;
+    float offset = m.diameter * 0.5f;
+    m.x += offset * m.dirX;
 
     //y0 = oldball->yPos;
 
-    initTop();
-    init();
+    initTop(m);
+    init(m);
 
     // Initialize for upward push from current position
-    dirY = -1;
-    time = maxTime / 2;  // Start at mid-flight to move upwards
+    m.dirY = -1;
+    m.time = m.maxTime / 2;  // Start at mid-flight to move upwards
 
     // Calculate y0 so physics equation gives us yPos at this time:
     // yPos = (MAX_Y - top) + y0 + 0.5 * gravity * time²
     // Solving: y0 = yPos - (MAX_Y - top) - 0.5 * gravity * time²
-    y0 = yPos - (float)(Stage::MAX_Y - top) - 0.5f * gravity * time * time;
+    m.y0 = m.y - (float)(Stage::MAX_Y - m.top) - 0.5f * m.gravity * m.time * m.time;
+    setMotion(m);
+}
+
+/**
+ * Copy of a ball in another lane (scene snapshots save and restore balls
+ * this way). Flashing copies do not move, like the original.
+ */
+Ball::Ball(BallKernel& mot, Uint32 ln, const Ball& other)
+    : Ball(other)
+{
+    motion = &mot;
+    lane = ln;
+    setMotion(other.getMotion());
+    motion->setMoving(lane, !flashing);
 }
 
 Ball::~Ball()
 {
 }
 
-void Ball::init()
+int Ball::defaultDiameter(int size)
+{
+    static const int DIAMETERS[] = { 81, 41, 21, 11 };
+    return DIAMETERS[std::min(std::max(size, 0), 3)];
+}
+
+int Ball::diameterFor(int size, int color)
+{
+    // Get diameter from the ball spritesheet
+    StageResources& res = gameinf.getStageRes();
+    AnimSpriteSheet* anim = res.getBallAnim(color);
+    Sprite* spr = anim ? anim->getFrame(size) : nullptr;
+    return spr ? spr->getWidth() : defaultDiameter(size);
+}
+
+void Ball::init(BallMotion& m) const
 {
-    gravity = 8 / ((float)(top - diameter) * (400.0f / top));
-    maxTime = std::sqrt((float)(2 * (top - diameter)) / (gravity));
+    m.gravity = 8 / ((float)(m.top - m.diameter) * (400.0f / m.top));
+    m.maxTime = std::sqrt((float)(2 * (m.top - m.diameter)) / (m.gravity));
 }
 
 Sprite* Ball::getCurrentSprite() const
@@ -149,6 +165,7 @@ void Ball::kill()
     {
         flashing = true;
         flashTimer = FLASH_DURATION;
+        motion->setMoving(lane, false);  // BallKernel::step() leaves it in place
         // onDeath() is called by IGameObject::kill() when the flash expires,
         // ensuring it fires exactly once (splash effect, events, pickup spawn).
     }
@@ -160,42 +177,65 @@ void Ball::kill()
  * This function is called when the top parameter is not defined (top=0).
  * It calculates the maximum jump height for the ball based on its diameter.
  */
-void Ball::initTop()
+void Ball::initTop(BallMotion& m) const
 {
     float d = (float)(Stage::MAX_Y - Stage::MIN_Y);
 
     if (size == 0)
-        top = (int)d;
+        m.top = (int)d;
     else if (size == 1)
-        top = (int)(d * 0.6f);
+        m.top = (int)(d * 0.6f);
     else if (size == 2)
-        top = (int)(d * 0.4f);
+        m.top = (int)(d * 0.4f);
     else if (size == 3)
-        top = (int)(d * 0.26f);
+        m.top = (int)(d * 0.26f);
     else
-        top = (int)(d * 0.1f);
+        m.top = (int)(d * 0.1f);
 }
 
 void Ball::setDir(float dx, int dy)
 {
-    dirX = dx;
-    dirY = dy;
+    BallMotion m = getMotion();
+    m.dirX = dx;
+    m.dirY = dy;
+    setMotion(m);
 }
 
 void Ball::setDirX(float dx)
 {
-    dirX = dx;
+    BallMotion m = getMotion();
+    m.dirX = dx;
+    setMotion(m);
 }
 
 void Ball::setDirY(int dy)
 {
-    dirY = dy;	
+    BallMotion m = getMotion();
+    m.dirY = dy;
+    setMotion(m);
+}
+
+void Ball::bounceAtImpact(float toi, const CollisionSide& side, float dt)
+{
+    BallMotion m = getMotion();
+    m.x = xStep + (m.x - xStep) * toi;
+
+    // Same parabola: the impact height determines the time
+    float impactY = yStep + (m.y - yStep) * toi;
+    m.time = timeAtHeight(m, impactY);
+    m.y = (float)(Stage::MAX_Y - m.top + 1) + m.y0 + 0.5f * m.gravity * (m.time * m.time);
+
+    if (side.hasHorizontal()) m.dirX = -m.dirX;
+    if (side.hasVertical()) m.dirY = -m.dirY;
+    setMotion(m);
+
+    if (dt > 0.0f && toi < 1.0f)
+        update((1.0f - toi) * dt);
 }
 
 void Ball::setPos(int x, int y)
 {
-    xPos = (float)x;
-    yPos = (float)y;
+    setPos((float)x, (float)y);
 }
 
 /**
@@ -222,11 +262,29 @@ bool Ball::collision(Player* pl)
 }
 
 /**
- * move()
+ * Time (in ticks, see update()) at which the current parabola reaches
+ * the screen height h, or 0 if h is at or above the parabola's apex.
+ */
+float Ball::timeAtHeight(const BallMotion& m, float h)
+{
+    float d = h - (float)(Stage::MAX_Y - m.top + 1) - m.y0;
+    if (d <= 0.0f)
+        return 0.0f;
+    return std::sqrt(2.0f * d / m.gravity);
+}
+
+/**
+ * update()
  *
  * Moves the ball based on the physical equations of free fall:
  * S = S0 + V0t + 1/2 a * t^2
  * where S is y and S0 is y0.
+ *
+ * The parabola is evaluated in closed form: time is measured in 60 Hz
+ * ticks and advanced by dt, and bounces (floor, ceiling, apex, walls) are
+ * resolved at the exact moment they happen within the step, carrying the
+ * rest of the step past the bounce. Any fixed timestep therefore traces
+ * the same trajectory; only the sampling density changes.
  */
 void Ball::update(float dt)
 {
@@ -242,60 +300,83 @@ void Ball::update(float dt)
         return;  // Don't move during flash
     }
 
-    float incx = dirX * 0.80f;
-
-    // Calculate new Y position using physics equation
-    yPos = y0 + 0.5f * gravity * (time * time);
-    yPos = (float)(Stage::MAX_Y - top + 1) + yPos;
+    BallMotion m = getMotion();
+    float ticks = dt * GameState::GLOBAL_UPDATE_FRAMERATE;
 
-    xPos += incx;
-    time += (float)dirY;
+    // Horizontal: constant speed, reflected off the side walls
+    m.x += m.dirX * SPEED_X * ticks;
 
-    if (dirY == 1)
+    if (m.dirX > 0)
     {
-        // Falling: check if hit floor
-        if (yPos + diameter >= Stage::MAX_Y+1)
+        if (m.x + m.diameter >= Stage::MAX_X)
         {
-            y0 = 0;
-            dirY = -1;
-            time = maxTime;
+            m.x = 2.0f * (float)(Stage::MAX_X - m.diameter) - m.x;
+            m.dirX = -m.dirX;
         }
     }
-    else if (dirY == -1)
+    else if (m.dirX < 0)
     {
-        // Rising: check if hit ceiling
-        if (yPos <= Stage::MIN_Y)
+        if (m.x <= Stage::MIN_X)
         {
-            yPos = (float)Stage::MIN_Y;
-            dirY = 1;
-            time = 0;
-            // Calculate y0 so ball falls from ceiling position
-            y0 = (float)Stage::MIN_Y - (float)(Stage::MAX_Y - top);
-        }
-        // Rising: check if reached peak (time-based detection)
-        else if (time <= 0)
-        {
-            time = 0;
-            dirY = 1;
+            m.x = 2.0f * (float)Stage::MIN_X - m.x;
+            m.dirX = -m.dirX;
         }
     }
 
-    if (dirX > 0)
+    // Vertical: consume the step event by event (a step can span a bounce)
+    const float floorY = (float)(Stage::MAX_Y + 1 - m.diameter);
+    float remaining = ticks;
+
+    for (int events = 0; remaining > 0.0f && events < 4; events++)
     {
-        if (xPos + diameter >= Stage::MAX_X)
+        if (m.dirY == 1)
         {
-            xPos = (float)(Stage::MAX_X - diameter);
-            dirX = -dirX;
+            // Falling: time grows until the ball touches the floor
+            float tFloor = timeAtHeight(m, floorY);
+            if (m.time + remaining < tFloor)
+            {
+                m.time += remaining;
+                remaining = 0.0f;
+            }
+            else
+            {
+                remaining -= std::max(0.0f, tFloor - m.time);
+                m.y0 = 0;
+                m.dirY = -1;
+                m.time = m.maxTime;
+            }
         }
-    }
-    else if (dirX < 0)
-    {
-        if (xPos <= Stage::MIN_X)
+        else if (m.dirY == -1)
+        {
+            // Rising: time shrinks to the apex (0), or to the ceiling if it is lower
+            float tCeil = timeAtHeight(m, (float)Stage::MIN_Y);
+            if (m.time - remaining > tCeil)
+            {
+                m.time -= remaining;
+                remaining = 0.0f;
+            }
+            else
+            {
+                remaining -= std::max(0.0f, m.time - tCeil);
+                if (tCeil > 0.0f)
+                {
+                    // Hit the ceiling: fall from it with zero speed
+                    m.y0 = (float)Stage::MIN_Y - (float)(Stage::MAX_Y - m.top + 1);
+                }
+                m.dirY = 1;
+                m.time = 0;
+            }
+        }
+        else
         {
-            xPos = (float)Stage::MIN_X;
-            dirX = -dirX;
+            break;
         }
     }
+
+    // Calculate new Y position using physics equation
+    m.y = m.y0 + 0.5f * m.gravity * (m.time * m.time);
+    m.y = (float)(Stage::MAX_Y - m.top + 1) + m.y;
+    setMotion(m);
 }
 
 void Ball::onDeath()
@@ -309,8 +390,8 @@ void Ball::onDeath()
     AnimSpriteSheet* tmpl = res.getBallSplashAnim(static_cast<int>(color));
     if (tmpl)
     {
-        int cx = (int)xPos + diameter / 2;
-        int cy = (int)yPos + diameter / 2 + (int)(tmpl->getHeight() * scale);
+        int cx = (int)getX() + getDiameter() / 2;
+        int cy = (int)getY() + getDiameter() / 2 + (int)(tmpl->getHeight() * scale);
         scene->spawnEffect(tmpl, cx, cy, scale);
     }
 
@@ -328,34 +409,34 @@ void Ball::onDeath()
     {
         if (deathPickups[i].size == size)
         {
-            int cx = (int)xPos + diameter / 2;
-            int cy = (int)yPos + diameter / 2;
+            int cx, cy;
+            getCollisionCenter(cx, cy);
             scene->addPickup(cx, cy, deathPickups[i].type);
             break;  // At most one pickup per size level
         }
     }
 }
 
-std::pair<std::unique_ptr<Ball>, std::unique_ptr<Ball>> Ball::createChildren()
+int Ball::createChildren(BallPool& pool)
 {
     // Only create children if ball is large enough to split
     if (size >= 3)
     {
-        return { nullptr, nullptr };
+        return 0;
     }
 
-    auto child1 = std::make_unique<Ball>(scene, this, -1);  // Left
-    auto child2 = std::make_unique<Ball>(scene, this, 1);   // Right
+    Ball* child1 = pool.emplace(scene, this, -1);  // Left
+    Ball* child2 = pool.emplace(scene, this, 1);   // Right
 
     // Propagate pickups bound to sizes beyond this ball to one random child.
     // Both children are size+1; only one (chosen randomly) inherits the entries
     // so each pickup item can only appear once across the whole split tree.
-    Ball* lucky = (rand() % 2 == 0) ? child1.get() : child2.get();
+    Ball* lucky = scene->getRandom().chance() ? child1 : child2;
     for (int i = 0; i < deathPickupCount; i++)
     {
         if (deathPickups[i].size > size)
             lucky->addDeathPickup(deathPickups[i]);
     }
 
-    return { std::move(child1), std::move(child2) };
+    return 2;
 }
\ No newline at end of file
@@ -1,21 +1,26 @@
 #pragma once
 
 #include <SDL.h>
-#include <memory>
 #include "gameobject.h"
 #include "../core/collisionbox.h"
 #include "pickuptype.h"
+#include "../game/ballkernel.h"
 
 class Scene;
 class Shot;
 class Player;
 class Platform;
 class Sprite;
+class BallPool;
 
 /**
  * Ball class
  *
  * It is the game ball, which must be shot.
+ *
+ * Position and motion live in the owning BallPool's BallKernel (lane =
+ * the ball's index in the pool), so balls are only constructed through
+ * BallPool::emplace().
  */
 class Ball : public IGameObject
 {
@@ -23,16 +28,13 @@ public:
     enum class Color { Red = 0, Green = 1, Blue = 2 };
 
 private:
-    int top; // maximum height from the floor
-    int diameter;
+    friend class BallPool;  // keeps lane in the pool's dense order
+
+    BallKernel* motion;  // motion store of the owning pool
+    Uint32 lane;         // this ball's index in motion
     int size;
     Color color = Color::Red;
 
-    float dirX; // horizontal direction (float: 1.0=right, -1.0=left; magnitude acts as speed multiplier)
-    int dirY;   // vertical direction (-1=up, 1=down)
-    float time, maxTime;
-    float y0; // initial space
-    float gravity; // acceleration (acc)
     Scene* scene;
     DeathPickupEntry deathPickups[MAX_DEATH_PICKUPS] = {};
     int deathPickupCount = 0;
@@ -42,34 +44,68 @@ private:
     float flashTimer = 0.0f;
     static constexpr float FLASH_DURATION = 0.04f;  // 40ms
 
+    Ball(const Ball&) = default;
+
+    BallMotion getMotion() const { return motion->get(lane); }
+    void setMotion(const BallMotion& m) { motion->set(lane, m); }
+
+    void init(BallMotion& m) const;
+    void initTop(BallMotion& m) const;
+    static float timeAtHeight(const BallMotion& m, float h);
+
 public:
-    Ball(Scene* scene, Ball* oldBall, int dir);
-    Ball(Scene* scene, int x, int y, int size, float dirX = 1.0f, int dirY = 1, int top = 0, int color = 0);
-    ~Ball();
+    static constexpr float SPEED_X = 0.80f;  // horizontal pixels per 60 Hz tick (times |dirX|)
 
-    void init();
-    void initTop();
+    Ball(BallKernel& motion, Uint32 lane, Scene* scene, Ball* oldBall, int dir);
+    Ball(BallKernel& motion, Uint32 lane, Scene* scene, int x, int y, int size, float dirX = 1.0f, int dirY = 1, int top = 0, int color = 0);
+
+    /**
+     * @brief Copy of another ball in a new lane (used by scene snapshots)
+     */
+    Ball(BallKernel& motion, Uint32 lane, const Ball& other);
+    ~Ball();
 
     void update(float dt);
 
+    // Position lives in the motion store
+    void setPos(float x, float y) override { motion->setX(lane, x); motion->setY(lane, y); }
+    void setX(float x) override { motion->setX(lane, x); }
+    void setY(float y) override { motion->setY(lane, y); }
+    float getX() const override { return motion->getX(lane); }
+    float getY() const override { return motion->getY(lane); }
+
     // IGameObject lifecycle hook
     void onDeath() override;
 
     /**
      * @brief Create child balls when this ball is destroyed
      *
-     * If ball is large enough (size < 3), creates two smaller balls.
-     * Returns a pair of unique_ptr, which will be nullptr if the ball
-     * is too small to split.
+     * If ball is large enough (size < 3), creates two smaller balls
+     * directly in the pool. Must be called before this ball is erased.
      *
-     * @return Pair of unique_ptr to child balls (nullptr if no split)
+     * @param pool Pool receiving the children
+     * @return Number of children created (0 or 2)
      */
-    std::pair<std::unique_ptr<Ball>, std::unique_ptr<Ball>> createChildren();
+    int createChildren(BallPool& pool);
 
     bool collision(Shot* shot);
     bool collision(Platform* floor);
     bool collision(Player* player);
 
+    /**
+     * @brief Bounce off a platform touched part-way through the last step
+     *
+     * Used for swept collisions: moves the ball back along the step to
+     * where it touched the platform (the parabola time follows from the
+     * height), reverses the directions of the hit sides and spends the rest
+     * of the step moving away.
+     *
+     * @param toi Fraction of the last step at which the ball touched [0,1]
+     * @param side Side(s) of the platform that were hit
+     * @param dt Length of the last step in seconds (0 = stop at the impact point)
+     */
+    void bounceAtImpact(float toi, const CollisionSide& side, float dt);
+
     void setDir(float dx, int dy);
     void setDirX(float dx);
     void setDirY(int dy);
@@ -98,11 +134,24 @@ public:
     }
 
     // Getters
-    float getDirX() const { return dirX; }
-    int getDirY() const { return dirY; }
+    float getDirX() const { return getMotion().dirX; }
+    int getDirY() const { return getMotion().dirY; }
     int getSize() const { return size; }
-    float getTime() const { return time; }
-    int getDiameter() const { return diameter; }
+    float getTime() const { return getMotion().time; }
+    float getY0() const { return getMotion().y0; }
+    int getDiameter() const { return motion->getDiameter(lane); }
+
+    /**
+     * @brief Diameter of a ball size when its sprite is not loaded
+     * (same as the stock ball.json frames; used without stage resources)
+     */
+    static int defaultDiameter(int size);
+
+    /**
+     * @brief Diameter of a ball size and color: its sprite width, or
+     * defaultDiameter() when the sprite is not loaded
+     */
+    static int diameterFor(int size, int color);
     bool isInFlashState() const { return flashing; }
     Sprite* getCurrentSprite() const;
 
@@ -110,7 +159,7 @@ public:
      * @brief Get collision radius for circle collision detection
      * @return Half the ball's diameter
      */
-    int getCollisionRadius() const { return diameter / 2; }
+    int getCollisionRadius() const { return getDiameter() / 2; }
 
     /**
      * @brief Get collision center point for circle collision detection
@@ -118,8 +167,9 @@ public:
      * @param cy Output y coordinate of center
      */
     void getCollisionCenter(int& cx, int& cy) const {
-        cx = (int)xPos + diameter / 2;
-        cy = (int)yPos + diameter / 2;
+        int diameter = getDiameter();
+        cx = (int)motion->getX(lane) + diameter / 2;
+        cy = (int)motion->getY(lane) + diameter / 2;
     }
 
     /**
@@ -132,6 +182,7 @@ public:
      * @return Collision box in top-left coordinate space
      */
     CollisionBox getCollisionBox() const override {
-        return { (int)xPos, (int)yPos, diameter, diameter };
+        int diameter = getDiameter();
+        return { (int)motion->getX(lane), (int)motion->getY(lane), diameter, diameter };
     }
 };
\ No newline at end of file
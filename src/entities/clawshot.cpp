@@ -9,6 +9,15 @@
 #include "../core/sprite.h"
 #include "logger.h"
 
+// Snapshots clone straight into ShotPool slots, bypassing emplace<U>()'s size check
+static_assert(sizeof(ClawShot) <= ShotPool::SLOT_SIZE && alignof(ClawShot) <= ShotPool::SLOT_ALIGN,
+              "ClawShot does not fit in a ShotPool slot: add it to SHOT_SLOT_SIZE/SHOT_SLOT_ALIGN (entitypools.h)");
+
+Shot* ClawShot::cloneInto(void* memory) const
+{
+    return new (memory) ClawShot(*this);
+}
+
 /**
  * ClawShot constructor
  *
@@ -54,6 +63,15 @@ ClawShot::ClawShot(Scene* scn, Player* pl, WeaponType type)
     }
 }
 
+ClawShot::ClawShot(const ClawShot& other)
+    : Shot(other),
+      clawAnim(other.clawAnim ? other.clawAnim->clone() : nullptr),
+      clawYellowAnim(other.clawYellowAnim ? other.clawYellowAnim->clone() : nullptr),
+      stuck(other.stuck), stuckTimer(other.stuckTimer)
+{
+    audioChannel = -1;
+}
+
 /**
  * Update movement and stuck timer.
  */
@@ -86,10 +104,12 @@ void ClawShot::update(float dt)
 /**
  * Draw tip (or claw head when stuck) followed by tiled chain down to yInit.
  */
-void ClawShot::draw(Graph* graph)
+void ClawShot::draw(Graph* graph, float alpha)
 {
     if (!clawAnim) return;
 
+    int tipY = (int)getRenderY(alpha);  // Interpolated between the last two simulation steps
+
     // Use yellow skin during the last second while stuck; default otherwise
     bool useYellow = stuck && stuckTimer <= WARN_THRESHOLD && clawYellowAnim;
     AnimSpriteSheet* skin = useYellow ? clawYellowAnim.get() : clawAnim.get();
@@ -106,10 +126,10 @@ void ClawShot::draw(Graph* graph)
     Sprite* topSpr = stuck ? headSpr : tipSpr;
 
     // Draw top sprite (xOff applied automatically by graph->draw)
-    graph->draw(topSpr, (int)xPos, (int)yPos);
+    graph->draw(topSpr, (int)xPos, tipY);
 
     // Tile the chain from below the top sprite down to yInit (player feet)
-    int chainTop    = (int)yPos + topSpr->getHeight();
+    int chainTop    = tipY + topSpr->getHeight();
     int chainBottom = (int)yInit;
     int tileH       = chainSpr->getHeight();
 
@@ -33,10 +33,13 @@ private:
 
 public:
     ClawShot(Scene* scn, Player* pl, WeaponType type);
+    ClawShot(const ClawShot& other);
     ~ClawShot() = default;
 
+    Shot* cloneInto(void* memory) const override;
+
     void update(float dt) override;
-    void draw(Graph* graph) override;
+    void draw(Graph* graph, float alpha) override;
     CollisionBox getCollisionBox() const override;
 
     /**
@@ -9,6 +9,15 @@
 #include "../core/animcontroller.h"
 #include "../core/coordhelper.h"
 
+// Snapshots clone straight into ShotPool slots, bypassing emplace<U>()'s size check
+static_assert(sizeof(GunShot) <= ShotPool::SLOT_SIZE && alignof(GunShot) <= ShotPool::SLOT_ALIGN,
+              "GunShot does not fit in a ShotPool slot: add it to SHOT_SLOT_SIZE/SHOT_SLOT_ALIGN (entitypools.h)");
+
+Shot* GunShot::cloneInto(void* memory) const
+{
+    return new (memory) GunShot(*this);
+}
+
 /**
  * GunShot constructor
  *
@@ -23,10 +32,11 @@ GunShot::GunShot(Scene* scn, Player* pl, AnimSpriteSheet* animSheet)
 {
     // Clone the AnimSpriteSheet template for this bullet instance
     anim = animSheet->clone();
+    dieState = anim->findState("die");
 
     // Set callback to kill shot when die animation completes
-    anim->setOnStateComplete([this](const std::string& state) {
-        if (state == "die")
+    anim->setOnStateComplete([this](StateMachineAnim::StateId state) {
+        if (state == dieState)
         {
             kill();
         }
@@ -60,6 +70,12 @@ GunShot::GunShot(Scene* scn, Player* pl, AnimSpriteSheet* animSheet)
         scene->spawnEffect(sparkTmpl, (int)xPos, yPos);// (int)( pl->getY() - pl->getHeight() + 2 ));
 }
 
+GunShot::GunShot(const GunShot& other)
+    : Shot(other), anim(other.anim ? other.anim->clone() : nullptr), inImpact(other.inImpact), dieState(other.dieState)
+{
+    audioChannel = -1;
+}
+
 GunShot::~GunShot()
 {
 }
@@ -107,7 +123,7 @@ void GunShot::triggerImpact(float impactY)
     if (!inImpact)
     {
         inImpact = true;
-        anim->setState("die");
+        anim->setState(dieState);
         player->looseShoot();  // Decrement player's shot count
         yPos = impactY + anim->getHeight();  // Align Y position to impacted element (sprite pixels are top aligned)
     }
@@ -118,14 +134,14 @@ void GunShot::triggerImpact(float impactY)
  *
  * Renders the current frame from the sprite sheet.
  */
-void GunShot::draw(Graph* graph)
+void GunShot::draw(Graph* graph, float alpha)
 {
     Sprite* frame = anim->getCurrentSprite();
 
     if (frame)
     {
-        int renderX = toRenderX(xPos, anim->getWidth());
-        int renderY = toRenderY(yPos, anim->getHeight());
+        int renderX = toRenderX(getRenderX(alpha), anim->getWidth());
+        int renderY = toRenderY(getRenderY(alpha), anim->getHeight());
 
         graph->draw(frame, renderX, renderY);
     }
@@ -20,6 +20,7 @@ class GunShot : public Shot
 private:
     std::unique_ptr<AnimSpriteSheet> anim;
     bool inImpact = false;     // Track if we're in impact state (for movement logic)
+    StateMachineAnim::StateId dieState = StateMachineAnim::NO_STATE;
 
 public:
     /**
@@ -29,11 +30,14 @@ public:
      * @param animSheet AnimSpriteSheet containing gun bullet frames and animation
      */
     GunShot(Scene* scn, Player* pl, AnimSpriteSheet* animSheet);
+    GunShot(const GunShot& other);
     ~GunShot();
 
+    Shot* cloneInto(void* memory) const override;
+
     // Implement abstract interface from Shot
     void update(float dt) override;
-    void draw(Graph* graph) override;
+    void draw(Graph* graph, float alpha) override;
 
     /**
      * @brief Get collision box for the gun bullet sprite
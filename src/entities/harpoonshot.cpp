@@ -8,6 +8,15 @@
 #include "../core/sprite.h"
 #include "../core/spritesheet.h"
 
+// Snapshots clone straight into ShotPool slots, bypassing emplace<U>()'s size check
+static_assert(sizeof(HarpoonShot) <= ShotPool::SLOT_SIZE && alignof(HarpoonShot) <= ShotPool::SLOT_ALIGN,
+              "HarpoonShot does not fit in a ShotPool slot: add it to SHOT_SLOT_SIZE/SHOT_SLOT_ALIGN (entitypools.h)");
+
+Shot* HarpoonShot::cloneInto(void* memory) const
+{
+    return new (memory) HarpoonShot(*this);
+}
+
 /**
  * HarpoonShot constructor
  *
@@ -60,6 +69,16 @@ HarpoonShot::HarpoonShot(Scene* scn, Player* pl, WeaponType type)
         scene->spawnEffect(sparkTmpl, (int)xPos + tipWidth / 2, (int)(pl->getY() - pl->getHeight()) + 7);
 }
 
+HarpoonShot::HarpoonShot(const HarpoonShot& other)
+    : Shot(other), tipSpr(other.tipSpr)
+{
+    // Independent copy of the chain animation at its current frame
+    const IAnimController* ctrl = other.chainSpr.getController();
+    chainSpr.init(&gameinf.getStageRes().harpoonChain,
+                  ctrl ? ctrl->clone() : gameinf.getStageRes().harpoonAnim->clone());
+    audioChannel = -1;
+}
+
 HarpoonShot::~HarpoonShot()
 {
 }
@@ -99,24 +118,32 @@ void HarpoonShot::update(float dt)
  * chain extending downward to the anchor point (yInit = player's feet).
  * The last tile is clipped to not extend past yInit.
  */
-void HarpoonShot::draw(Graph* graph)
+void HarpoonShot::draw(Graph* graph, float alpha)
 {
     Sprite* tipSprite = tipSpr.getActiveSprite();
     Sprite* chainFrame = chainSpr.getActiveSprite();
 	int tipCutoff = 15;  // Pixels to cut off from the bottom of the tip sprite for better visual connection with chain
+    int tipY = (int)getRenderY(alpha);  // Interpolated between the last two simulation steps
+
+    // Tip and chain tiles are queued and go out as one batch
+    graph->beginBatch();
 
     // Draw tip sprite (yPos already accounts for sprite height offset)
     if (tipSprite)
     {
-        graph->drawClipped(tipSprite, (int)xPos, (int)yPos, tipSprite->getHeight()-tipCutoff);
+        graph->drawClipped(tipSprite, (int)xPos, tipY, tipSprite->getHeight()-tipCutoff);
     }
 
     // Draw animated chain from tip bottom down to the anchor point (yInit)
     //LOG_DEBUG("Harpoon tailAnim frame: %d", chainSpr.getCurrentFrame());
-    if (!chainFrame) return;  // Safety check
+    if (!chainFrame)  // Safety check
+    {
+        graph->endBatch();
+        return;
+    }
 
     int tileHeight = chainFrame->getHeight();
-    int chainTop = (int)yPos + tipSpr.getHeight() - tipCutoff;
+    int chainTop = tipY + tipSpr.getHeight() - tipCutoff;
     int chainBottom = (int)yInit;
 
     for (int tileY = chainTop; tileY < chainBottom; tileY += tileHeight)
@@ -130,7 +157,7 @@ void HarpoonShot::draw(Graph* graph)
         else
         {
             // Last tile would extend past anchor - draw clipped
-            // Use SDL_RenderCopy with a source rect to clip the sprite
+            // (source rect cut to the visible part of the sprite)
             int visibleHeight = chainBottom - tileY;
             if (visibleHeight > 0)
             {
@@ -138,6 +165,8 @@ void HarpoonShot::draw(Graph* graph)
             }
         }
     }
+
+    graph->endBatch();
 }
 
 /**
@@ -28,11 +28,14 @@ public:
      * @param xOffset Horizontal offset for multi-projectile weapons
      */
     HarpoonShot(Scene* scn, Player* pl, WeaponType type);
+    HarpoonShot(const HarpoonShot& other);
     ~HarpoonShot();
 
+    Shot* cloneInto(void* memory) const override;
+
     // Implement abstract interface from Shot
     void update(float dt) override;
-    void draw(Graph* graph) override;
+    void draw(Graph* graph, float alpha) override;
 
     /**
      * @brief Get collision box for the harpoon chain (ball/hexa collision)
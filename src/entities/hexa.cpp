@@ -58,6 +58,23 @@ Hexa::Hexa(Scene* scn, Hexa* parent, int dirX, int dirY)
     animCtrl = std::make_unique<FrameSequenceAnim>(FrameSequenceAnim::range(start, start + 3, 100, 0));
 }
 
+Hexa::Hexa(const Hexa& other)
+    : IGameObject(other), velX(other.velX), velY(other.velY), size(other.size),
+      color(other.color), width(other.width), height(other.height), scene(other.scene),
+      deathPickupCount(other.deathPickupCount), flashing(other.flashing), flashTimer(other.flashTimer)
+{
+    for (int i = 0; i < deathPickupCount; i++)
+        deathPickups[i] = other.deathPickups[i];
+
+    if (other.animCtrl)
+        animCtrl.reset(static_cast<FrameSequenceAnim*>(other.animCtrl->clone().release()));
+}
+
+std::unique_ptr<Hexa> Hexa::clone() const
+{
+    return std::make_unique<Hexa>(*this);
+}
+
 void Hexa::update(float dt)
 {
     // Handle flash state (countdown before actual death)
@@ -75,30 +92,37 @@ void Hexa::update(float dt)
     // Advance frame animation (dt is in seconds, animCtrl expects milliseconds)
     animCtrl->update(dt * 1000.0f);
 
+    // Velocities are in pixels per 60 Hz tick
+    move(dt * GameState::GLOBAL_UPDATE_FRAMERATE);
+}
+
+void Hexa::move(float ticks)
+{
     // Constant velocity movement
-    xPos += velX;
-    yPos += velY;
+    xPos += velX * ticks;
+    yPos += velY * ticks;
 
-    // Screen edge bouncing
+    // Screen edge bouncing: reflect the overshoot so the path does not
+    // depend on the step size
     if (velX > 0 && xPos + width >= Stage::MAX_X)
     {
-        xPos = (float)(Stage::MAX_X - width);
+        xPos = 2.0f * (float)(Stage::MAX_X - width) - xPos;
         velX = -velX;
     }
     else if (velX < 0 && xPos <= Stage::MIN_X)
     {
-        xPos = (float)Stage::MIN_X;
+        xPos = 2.0f * (float)Stage::MIN_X - xPos;
         velX = -velX;
     }
 
     if (velY > 0 && yPos + height >= Stage::MAX_Y+1)
     {
-        yPos = (float)(Stage::MAX_Y - height);
+        yPos = 2.0f * (float)(Stage::MAX_Y + 1 - height) - yPos;
         velY = -velY;
     }
     else if (velY < 0 && yPos <= Stage::MIN_Y)
     {
-        yPos = (float)Stage::MIN_Y;
+        yPos = 2.0f * (float)Stage::MIN_Y - yPos;
         velY = -velY;
     }
 }
@@ -152,6 +176,17 @@ void Hexa::onDeath()
     }
 }
 
+void Hexa::bounceAtImpact(float toi, const CollisionSide& side, float dt)
+{
+    xPos = xStep + (xPos - xStep) * toi;
+    yPos = yStep + (yPos - yStep) * toi;
+
+    handlePlatformBounce(side);
+
+    if (dt > 0.0f && toi < 1.0f)
+        move((1.0f - toi) * dt * GameState::GLOBAL_UPDATE_FRAMERATE);
+}
+
 void Hexa::handlePlatformBounce(const CollisionSide& side)
 {
     // Reflect velocity based on collision side
@@ -165,12 +200,12 @@ void Hexa::handlePlatformBounce(const CollisionSide& side)
     }
 }
 
-std::pair<std::unique_ptr<Hexa>, std::unique_ptr<Hexa>> Hexa::createChildren()
+int Hexa::createChildren(EntityPool<Hexa>& pool)
 {
     // Only create children if hexa is large enough to split
     if (size >= 2)
     {
-        return { nullptr, nullptr };
+        return 0;
     }
 
     // Children inherit parent's vertical direction:
@@ -178,18 +213,18 @@ std::pair<std::unique_ptr<Hexa>, std::unique_ptr<Hexa>> Hexa::createChildren()
     // - parent going up   → children go up-left and up-right
     int childDirY = -1;//(velY >= 0.0f) ? 1 : -1;
 
-    auto child1 = std::make_unique<Hexa>(scene, this, -1, childDirY);  // Left
-    auto child2 = std::make_unique<Hexa>(scene, this,  1, childDirY);  // Right
+    Hexa* child1 = pool.emplace(scene, this, -1, childDirY);  // Left
+    Hexa* child2 = pool.emplace(scene, this,  1, childDirY);  // Right
 
     // Propagate pickups bound to sizes beyond this hexa to one random child.
-    Hexa* lucky = (rand() % 2 == 0) ? child1.get() : child2.get();
+    Hexa* lucky = scene->getRandom().chance() ? child1 : child2;
     for (int i = 0; i < deathPickupCount; i++)
     {
         if (deathPickups[i].size > size)
             lucky->addDeathPickup(deathPickups[i]);
     }
 
-    return { std::move(child1), std::move(child2) };
+    return 2;
 }
 
 bool Hexa::collision(Shot* sh)
@@ -3,6 +3,7 @@
 #include <memory>
 #include <algorithm>
 #include "gameobject.h"
+#include "../core/entitypool.h"
 #include "pickuptype.h"
 
 // Forward declaration - only stored as unique_ptr in header
@@ -47,6 +48,12 @@ private:
     float flashTimer = 0.0f;
     static constexpr float FLASH_DURATION = 0.04f;  // 40ms
 
+    /**
+     * Advance position by the velocity, bouncing off the screen edges
+     * @param ticks Step length in 60 Hz ticks
+     */
+    void move(float ticks);
+
     // Static size dimensions (from hexa_green.json sourceSize/frame bounds)
     static constexpr int SIZES[][2] = {
         {51, 51},  // Size 0: Large
@@ -77,9 +84,15 @@ public:
 
     ~Hexa() = default;
 
+    /**
+     * Deep copy with an independent animation controller (used by scene snapshots)
+     */
+    Hexa(const Hexa& other);
+    std::unique_ptr<Hexa> clone() const;
+
     /**
      * Update position with constant velocity
-     * @param dt Delta time in seconds (used for screen bounds check only)
+     * @param dt Delta time in seconds (velocities are scaled to pixels per 60 Hz tick)
      */
     void update(float dt);
 
@@ -95,10 +108,22 @@ public:
     void handlePlatformBounce(const CollisionSide& side);
 
     /**
-     * Create child hexas when destroyed
-     * @return Pair of unique_ptr to children (nullptr if size 2)
+     * Bounce off a platform touched part-way through the last step (swept collision)
+     *
+     * Moves back along the step to the impact point, reflects the velocity
+     * and spends the rest of the step moving away.
+     *
+     * @param toi Fraction of the last step at which the hexa touched [0,1]
+     * @param side Which side of the platform was hit
+     * @param dt Length of the last step in seconds (0 = stop at the impact point)
+     */
+    void bounceAtImpact(float toi, const CollisionSide& side, float dt);
+
+    /**
+     * Create child hexas in the pool when destroyed (before this hexa is erased)
+     * @return Number of children created (0 if size 2)
      */
-    std::pair<std::unique_ptr<Hexa>, std::unique_ptr<Hexa>> createChildren();
+    int createChildren(EntityPool<Hexa>& pool);
 
     // Collision detection methods
     bool collision(Shot* shot);
@@ -3,36 +3,58 @@
 #include <cstdio>
 
 HitScore::HitScore(BMFontRenderer* font, int cx, int cy, int score)
-    : font(font), alpha(1.0f)
+    : HitScore()
 {
+    reset(font, cx, cy, score);
+}
+
+HitScore::HitScore()
+    : font(nullptr), alpha(1.0f), fadeDelay(FADE_START),
+      rise(0.0f, -RISE_DISTANCE, TOTAL_DURATION, Easing::EaseOut),
+      fade(1.0f, 0.0f, FADE_DURATION)
+{
+    scoreText[0] = '\0';
+}
+
+void HitScore::reset(BMFontRenderer* fontRenderer, int cx, int cy, int score)
+{
+    resetDead();
+    hasPrev = false;
+    font = fontRenderer;
     xPos = (float)cx;
     yPos = (float)cy;
     snprintf(scoreText, sizeof(scoreText), "%d", score);
 
-    // Rise upward with deceleration
-    auto par = std::make_unique<ActionParallel>();
-    par->add(tweenTo(&yPos, yPos - RISE_DISTANCE, TOTAL_DURATION, Easing::EaseOut));
-
-    // Fade out after a short delay
-    auto fadeSeq = std::make_unique<ActionSequence>();
-    fadeSeq->then(delay(FADE_START))
-           .then(tweenTo(&alpha, 0.0f, FADE_DURATION));
-    par->add(std::move(fadeSeq));
-
-    par->start();
-    animation = std::move(par);
+    // Rise upward with deceleration, fade out after a short delay
+    rise = Motion(yPos, yPos - RISE_DISTANCE, TOTAL_DURATION, Easing::EaseOut);
+    fade = Motion(1.0f, 0.0f, FADE_DURATION);
+    fadeDelay = FADE_START;
+    alpha = 1.0f;
 }
 
 void HitScore::update(float dt)
 {
-    if (!animation->update(dt))
+    bool rising = rise.update(dt);
+    yPos = rise.value();
+
+    // The part of dt past the delay already counts towards the fade
+    float fadeDt = dt;
+    if (fadeDelay > 0.0f)
+    {
+        fadeDelay -= dt;
+        fadeDt = fadeDelay < 0.0f ? -fadeDelay : 0.0f;
+    }
+    bool fading = fadeDelay > 0.0f || fade.update(fadeDt);
+    alpha = fade.value();
+
+    if (!rising && !fading)
         kill();
 }
 
-void HitScore::draw(Graph* /*graph*/)
+void HitScore::draw(Graph* /*graph*/, float renderAlpha)
 {
     unsigned char a = static_cast<unsigned char>(alpha * 255.0f);
     font->setColor(255, 80, 80, a);
-    font->text(scoreText, (int)xPos, (int)yPos, TextAlign::Center);
+    font->text(scoreText, (int)getRenderX(renderAlpha), (int)getRenderY(renderAlpha), TextAlign::Center);
     font->setColor(255, 255, 255, 255);
 }
@@ -1,9 +1,8 @@
 #pragma once
 
 #include "../core/gameobject.h"
-#include "../core/action.h"
+#include "../core/motion.h"
 #include "../ui/bmfont.h"
-#include <memory>
 
 class Graph;
 
@@ -15,14 +14,25 @@ class Graph;
  *
  * Inherits from IGameObject for automatic lifecycle management in Scene.
  * The owner (Scene) must keep the BMFontRenderer alive for the object's lifetime.
+ *
+ * Popups live in a RecyclePool; reset() restarts one in place, so the
+ * motion state is plain values rather than a heap-allocated Action tree.
  */
 class HitScore : public IGameObject
 {
 public:
     HitScore(BMFontRenderer* font, int cx, int cy, int score);
 
+    /// Empty popup for pools; call reset() before use
+    HitScore();
+
+    /**
+     * @brief Restart as a new popup (same parameters as the constructor)
+     */
+    void reset(BMFontRenderer* font, int cx, int cy, int score);
+
     void update(float dt);
-    void draw(Graph* graph);
+    void draw(Graph* graph, float renderAlpha = 1.0f);
 
     CollisionBox getCollisionBox() const override { return {0, 0, 0, 0}; }
 
@@ -34,6 +44,8 @@ private:
 
     BMFontRenderer* font;           ///< Non-owning; Scene manages lifetime
     float alpha;                    ///< Current alpha [0..1], tweened to 0
-    std::unique_ptr<Action> animation;
+    float fadeDelay;                ///< Time left before the fade starts (s)
+    Motion rise;                    ///< yPos: spawn Y -> spawn Y - RISE_DISTANCE
+    Motion fade;                    ///< alpha: 1 -> 0
     char scoreText[16];
 };
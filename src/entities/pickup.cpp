@@ -7,6 +7,7 @@
 #include "../core/graph.h"
 #include "../core/logger.h"
 #include "../core/coordhelper.h"
+#include <cmath>
 
 Pickup::Pickup(Scene* scene, int x, int y, PickupType type)
     : scene(scene), pickupType(type), falling(true), groundY(Stage::MAX_Y), groundTimer(0.0f)
@@ -31,8 +32,17 @@ Pickup::Pickup(Scene* scene, int x, int y, PickupType type)
     }
 }
 
-float Pickup::findGroundBelow() const
+Pickup::Pickup(const Pickup& other)
+    : IGameObject(other), scene(other.scene), sprite(other.sprite),
+      shieldAnim(other.shieldAnim ? other.shieldAnim->clone() : nullptr),
+      pickupType(other.pickupType), falling(other.falling), groundY(other.groundY),
+      groundTimer(other.groundTimer), landedPlatform(other.landedPlatform)
 {
+}
+
+float Pickup::findGroundBelow(Platform*& platform) const
+{
+    platform = nullptr;
     if (!scene)
         return (float)Stage::MAX_Y+1;
 
@@ -42,28 +52,16 @@ float Pickup::findGroundBelow() const
     int stripLeft  = (int)xPos - halfStrip;
     int stripRight = (int)xPos + halfStrip;
 
-    float bestY = (float)Stage::MAX_Y+1;
-
-    for (const auto& floor : scene->lsFloor)
-    {
-        if (floor->isDead() || floor->isInvisible())
-            continue;
-
-        CollisionBox box = floor->getCollisionBox();
-
-        // The pickup's center strip must overlap the platform horizontally
-        if (stripRight < box.x || stripLeft > box.x + box.w)
-            continue;
-
-        // Platform top must be at or below the pickup's current bottom (yPos)
-        if ((float)box.y < yPos)
-            continue;
-
-        if ((float)box.y < bestY)
-            bestY = (float)box.y;
-    }
+    // Platform top must be at or below the pickup's current bottom (yPos).
+    // The ray is one pixel wider on each side because the strip has always
+    // counted platforms that merely touch its edges.
+    SpatialQuery::RayHit hit;
+    if (!scene->getSpatialQuery().raycastDown(stripLeft - 1, stripRight + 1, (int)std::ceil(yPos),
+                                              Stage::MAX_Y + 1, hit))
+        return (float)Stage::MAX_Y+1;
 
-    return bestY;
+    platform = hit.platform;
+    return (float)hit.y;
 }
 
 void Pickup::update(float dt)
@@ -90,7 +88,8 @@ void Pickup::update(float dt)
         yPos += FALL_SPEED;
 
         // Find nearest platform below on every step so we don't overshoot
-        float platformY = findGroundBelow();
+        Platform* platformBelow = nullptr;
+        float platformY = findGroundBelow(platformBelow);
         groundY = platformY;
 
         if (yPos >= groundY)
@@ -98,25 +97,9 @@ void Pickup::update(float dt)
             yPos = groundY;
             falling = false;
 
-            // Record which platform we landed on (nullptr means the hard floor)
-            landedPlatform = nullptr;
-            if (groundY < (float)Stage::MAX_Y && scene)
-            {
-                int halfStrip = std::max(1, (int)(SPRITE_SIZE * 0.05f));
-                int stripLeft  = (int)xPos - halfStrip;
-                int stripRight = (int)xPos + halfStrip;
-                for (const auto& floor : scene->lsFloor)
-                {
-                    if (floor->isDead() || floor->isInvisible())
-                        continue;
-                    CollisionBox box = floor->getCollisionBox();
-                    if (stripRight >= box.x && stripLeft <= box.x + box.w && (float)box.y == groundY)
-                    {
-                        landedPlatform = floor.get();
-                        break;
-                    }
-                }
-            }
+            // Record which platform we landed on (nullptr means the hard floor);
+            // ties between platforms at the same height go to the first in list order
+            landedPlatform = (groundY < (float)Stage::MAX_Y) ? platformBelow : nullptr;
         }
     }
     else
@@ -130,7 +113,7 @@ void Pickup::update(float dt)
     }
 }
 
-void Pickup::draw(Graph* graph)
+void Pickup::draw(Graph* graph, float alpha)
 {
     if (isDead()) return;
 
@@ -148,7 +131,7 @@ void Pickup::draw(Graph* graph)
         // fall back to SPRITE_SIZE for static pickups.
         int w = shieldAnim ? shieldAnim->getWidth()  : sprite.getSprite()->getWidth();
         int h = shieldAnim ? shieldAnim->getHeight() : sprite.getSprite()->getHeight();
-        graph->draw(spr, toRenderX(xPos, w), toRenderY(yPos, h));
+        graph->draw(spr, toRenderX(getRenderX(alpha), w), toRenderY(getRenderY(alpha), h));
     }
 }
 
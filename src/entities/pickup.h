@@ -44,9 +44,10 @@ private:
 
     /**
      * Find the nearest platform top directly below the pickup's center.
-     * Returns Stage::MAX_Y if no platform is found.
+     * Returns Stage::MAX_Y + 1 if no platform is found.
+     * @param platform Receives the platform found (nullptr for the stage floor)
      */
-    float findGroundBelow() const;
+    float findGroundBelow(Platform*& platform) const;
 
 public:
     /**
@@ -59,6 +60,15 @@ public:
     Pickup(Scene* scene, int x, int y, PickupType type);
     ~Pickup() = default;
 
+    /**
+     * Deep copy with an independent shield animation (used by scene snapshots).
+     * The landed platform pointer is copied as-is; the snapshot remaps it.
+     */
+    Pickup(const Pickup& other);
+
+    Platform* getLandedPlatform() const { return landedPlatform; }
+    void setLandedPlatform(Platform* platform) { landedPlatform = platform; }
+
     /**
      * Update pickup position (fall physics)
      * @param dt Delta time in seconds
@@ -68,8 +78,9 @@ public:
     /**
      * Draw the pickup sprite
      * @param graph Graphics context
+     * @param alpha Interpolation factor between the last two simulation steps
      */
-    void draw(Graph* graph);
+    void draw(Graph* graph, float alpha = 1.0f);
 
     /**
      * Apply effect to player when collected
@@ -95,14 +95,17 @@ void Player::init()
     walkAnim = AnimSpriteSheet::load(&appGraph, walkPath);
     if (walkAnim)
     {
+        walkStateId = walkAnim->findState("walk");
+        stepStateId = walkAnim->findState("step");
+
         // Callback: "step" one-shot completes → resume walking
-        walkAnim->setOnStateComplete([this](const std::string& stateName) {
-            if (stateName == "step" && currentState == PlayerState::STEP_UP) {
+        walkAnim->setOnStateComplete([this](StateMachineAnim::StateId state) {
+            if (state == stepStateId && currentState == PlayerState::STEP_UP) {
                 yPos = stepUpTargetY;  // Apply Y snap only after animation completes
                 setState(PlayerState::WALKING);
             }
         });
-        sprite.registerAnimation("walk", walkAnim.get());
+        walkAnimId = sprite.registerAnimation("walk", walkAnim.get());
     }
     else
     {
@@ -116,7 +119,7 @@ void Player::init()
     victoryAnim = AnimSpriteSheet::load(&appGraph, victoryPath);
     if (victoryAnim)
     {
-        sprite.registerAnimation("victory", victoryAnim.get());
+        victoryAnimId = sprite.registerAnimation("victory", victoryAnim.get());
     }
     else
     {
@@ -129,11 +132,15 @@ void Player::init()
     climbAnim = AnimSpriteSheet::loadAsStateMachine(&appGraph, climbPath);
     if (climbAnim)
     {
-        sprite.registerAnimation("climb", climbAnim.get());
+        climbAnimId = sprite.registerAnimation("climb", climbAnim.get());
+        climbStateId = climbAnim->findState("climb");
+        climbStopStateId = climbAnim->findState("stop");
+        climbShootStateId = climbAnim->findState("shoot");
+        standupStateId = climbAnim->findState("standup");
 
         // Set callback for when standup completes → transition to IDLE
-        climbAnim->setOnStateComplete([this](const std::string& stateName) {
-            if (stateName == "standup" && currentState == PlayerState::WAKING_UP) {
+        climbAnim->setOnStateComplete([this](StateMachineAnim::StateId state) {
+            if (state == standupStateId && currentState == PlayerState::WAKING_UP) {
                 setState(PlayerState::IDLE);
             }
         });
@@ -349,7 +356,7 @@ void Player::climbUp()
 
         // Set animation to "standup" state (frame 4, 300ms, one-shot)
         if (climbAnim) {
-            climbAnim->setState("standup");
+            climbAnim->setState(standupStateId);
         }
     }
     else
@@ -410,20 +417,20 @@ void Player::update(float dt, Scene* scene)
         case PlayerState::CLIMBING:
             if (climbAnim) {
                 // Determine which climbing animation state to use based on player actions
-                std::string desiredState;
+                StateMachineAnim::StateId desiredState;
                 if (shotCounter > 0) {
                     // Currently shooting - show shoot animation
-                    desiredState = "shoot";
+                    desiredState = climbShootStateId;
                 } else if (climbingMoving) {
                     // Moving up or down - show climb animation
-                    desiredState = "climb";
+                    desiredState = climbStateId;
                 } else {
                     // Idle on ladder - show stop animation
-                    desiredState = "stop";
+                    desiredState = climbStopStateId;
                 }
 
                 // Only change state if different from current state
-                if (climbAnim->getStateName() != desiredState) {
+                if (climbAnim->getState() != desiredState) {
                     climbAnim->setState(desiredState);
                 }
 
@@ -673,16 +680,20 @@ void Player::onStageLoaded()
  * Player position is stored in bottom-middle coordinates; this method
  * converts to top-left for SDL rendering using coordhelper.
  */
-void Player::draw(Graph* graph)
+void Player::draw(Graph* graph, float alpha)
 {
     if (!visible) return;
 
     Sprite* spr = sprite.getActiveSprite();
     if (!spr) return;
 
+    // Interpolated position between the last two simulation steps
+    float drawX = getRenderX(alpha);
+    float drawY = getRenderY(alpha);
+
     RenderProps props = renderProps;
-    props.x = toRenderX(getX(), sprite.getWidth());
-    props.y = toRenderY(getY(), sprite.getHeight());
+    props.x = toRenderX(drawX, sprite.getWidth());
+    props.y = toRenderY(drawY, sprite.getHeight());
 
     // Draw shield effect animation behind player
     if (hasShield && shieldAnimInstance)
@@ -691,8 +702,8 @@ void Player::draw(Graph* graph)
         if (shieldSpr)
         {
             RenderProps shieldProps;
-            int shieldX = toRenderX(getX(), shieldAnimInstance->getWidth());
-            int shieldY = toRenderY(getY(), shieldAnimInstance->getHeight());
+            int shieldX = toRenderX(drawX, shieldAnimInstance->getWidth());
+            int shieldY = toRenderY(drawY, shieldAnimInstance->getHeight());
 
             //shieldProps.x = static_cast< int >(getX()) - shieldAnimInstance->getWidth() / 2;
             //shieldProps.y = static_cast<int>(getY()) - spr->getHeight() / 2 - shieldAnimInstance->getHeight() / 2;
@@ -779,29 +790,29 @@ void Player::setState(PlayerState newState)
         case PlayerState::WALKING:
             if (walkAnim) {
                 walkAnim->reset();
-                if (walkAnim->hasStates()) walkAnim->setState("walk");
-                sprite.setActiveAnimation("walk");
+                if (walkAnim->hasStates()) walkAnim->setState(walkStateId);
+                sprite.setActiveAnimation(walkAnimId);
             }
             break;
 
         case PlayerState::STEP_UP:
             if (walkAnim && walkAnim->hasStates()) {
-                walkAnim->setState("step");
-                sprite.setActiveAnimation("walk");
+                walkAnim->setState(stepStateId);
+                sprite.setActiveAnimation(walkAnimId);
             }
             break;
 
         case PlayerState::CLIMBING:
             if (climbAnim) {
                 climbAnim->reset();
-                climbAnim->setState("climb");
-                sprite.setActiveAnimation("climb");
+                climbAnim->setState(climbStateId);
+                sprite.setActiveAnimation(climbAnimId);
             }
             break;
 
         case PlayerState::WAKING_UP:
             if (climbAnim) {
-                climbAnim->setState("standup");
+                climbAnim->setState(standupStateId);
                 // Keep using climb animation for standup
             }
             break;
@@ -814,7 +825,7 @@ void Player::setState(PlayerState newState)
         case PlayerState::VICTORY:
             if (victoryAnim) {
                 victoryAnim->reset();
-                sprite.setActiveAnimation("victory");
+                sprite.setActiveAnimation(victoryAnimId);
                 LOG_INFO("Player %d entering victory mode", id + 1);
             }
             break;
@@ -824,4 +835,86 @@ void Player::setState(PlayerState newState)
             sprite.setFallbackFrame(ANIM_DEAD);
             break;
     }
-}
\ No newline at end of file
+}
+
+Player::Snapshot Player::saveSnapshot() const
+{
+    Snapshot s;
+    s.x = xPos;
+    s.y = yPos;
+    s.xDir = xDir;
+    s.yDir = yDir;
+    s.facing = facing;
+    s.lives = lives;
+    s.score = score;
+    s.idWeapon = idWeapon;
+    s.currentWeapon = currentWeapon;
+    s.maxShoots = maxShoots;
+    s.numShoots = numShoots;
+    s.shotCounter = shotCounter;
+    s.shotInterval = shotInterval;
+    s.animSpeed = animSpeed;
+    s.animCounter = animCounter;
+    s.moveIncrement = moveIncrement;
+    s.playing = playing;
+    s.immuneCounter = immuneCounter;
+    s.hasShield = hasShield;
+    s.visible = visible;
+    s.renderProps = renderProps;
+    s.state = currentState;
+    s.spawnX = spawnX;
+    s.spawnY = spawnY;
+    s.currentLadder = currentLadder;
+    s.climbSpeed = climbSpeed;
+    s.climbingMoving = climbingMoving;
+    s.stepUpTargetY = stepUpTargetY;
+    s.yVelocity = yVelocity;
+    s.grounded = grounded;
+    s.dead = dead;
+    return s;
+}
+
+void Player::restoreSnapshot(const Snapshot& s, bool ladderValid)
+{
+    deathAction.reset();
+
+    xPos = s.x;
+    yPos = s.y;
+    hasPrev = false;
+    xDir = s.xDir;
+    yDir = s.yDir;
+    facing = s.facing;
+    lives = s.lives;
+    score = s.score;
+    idWeapon = s.idWeapon;
+    currentWeapon = s.currentWeapon;
+    maxShoots = s.maxShoots;
+    numShoots = s.numShoots;
+    shotCounter = s.shotCounter;
+    shotInterval = s.shotInterval;
+    animSpeed = s.animSpeed;
+    animCounter = s.animCounter;
+    moveIncrement = s.moveIncrement;
+    playing = s.playing;
+    immuneCounter = s.immuneCounter;
+    hasShield = s.hasShield;
+    visible = s.visible;
+    renderProps = s.renderProps;
+    spawnX = s.spawnX;
+    spawnY = s.spawnY;
+    climbSpeed = s.climbSpeed;
+    climbingMoving = s.climbingMoving;
+    stepUpTargetY = s.stepUpTargetY;
+    yVelocity = s.yVelocity;
+    grounded = s.grounded;
+    dead = s.dead;
+
+    // Re-enter the saved state from a neutral one so setState() selects its
+    // animation (neither neutral state is a climbing state, so the ladder is kept)
+    currentState = (s.state == PlayerState::IDLE) ? PlayerState::SHOOTING : PlayerState::IDLE;
+    setState(s.state);
+    currentLadder = ladderValid ? s.currentLadder : nullptr;
+
+    if (hasShield && !shieldAnimInstance && gameinf.getStageRes().shieldAnim)
+        shieldAnimInstance = gameinf.getStageRes().shieldAnim->clone();
+}
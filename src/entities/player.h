@@ -92,6 +92,17 @@ private:
     // Climbing animation (loaded from Aseprite JSON with StateMachineAnim)
     std::unique_ptr<AnimSpriteSheet> climbAnim;
 
+    // Animation and state ids, resolved once at load so state changes never look up names
+    MultiAnimSprite::AnimId walkAnimId = MultiAnimSprite::NO_ANIM;
+    MultiAnimSprite::AnimId victoryAnimId = MultiAnimSprite::NO_ANIM;
+    MultiAnimSprite::AnimId climbAnimId = MultiAnimSprite::NO_ANIM;
+    StateMachineAnim::StateId walkStateId = StateMachineAnim::NO_STATE;         // walkAnim "walk"
+    StateMachineAnim::StateId stepStateId = StateMachineAnim::NO_STATE;         // walkAnim "step"
+    StateMachineAnim::StateId climbStateId = StateMachineAnim::NO_STATE;        // climbAnim "climb"
+    StateMachineAnim::StateId climbStopStateId = StateMachineAnim::NO_STATE;    // climbAnim "stop"
+    StateMachineAnim::StateId climbShootStateId = StateMachineAnim::NO_STATE;   // climbAnim "shoot"
+    StateMachineAnim::StateId standupStateId = StateMachineAnim::NO_STATE;      // climbAnim "standup"
+
     // Shield effect animation (cloned from stageRes template)
     std::unique_ptr<AnimSpriteSheet> shieldAnimInstance;
 
@@ -164,7 +175,7 @@ public:
     bool isVisible() const { return visible; }
 
     // Rendering
-    void draw(Graph* graph);
+    void draw(Graph* graph, float alpha = 1.0f);
 
     void init();
     // void setFrame(int frame); // Inherited from Sprite2D
@@ -242,6 +253,50 @@ public:
      */
     PlayerState getState() const { return currentState; }
 
+    /**
+     * Gameplay state captured by scene snapshots.
+     * Animation objects are not saved; restoreSnapshot() re-enters the
+     * saved PlayerState so the matching animation is selected again.
+     */
+    struct Snapshot
+    {
+        float x, y;
+        int xDir, yDir;
+        FacingDirection facing;
+        int lives, score, idWeapon;
+        WeaponType currentWeapon;
+        int maxShoots, numShoots, shotCounter, shotInterval;
+        int animSpeed, animCounter, moveIncrement;
+        bool playing;
+        int immuneCounter;
+        bool hasShield;
+        bool visible;
+        RenderProps renderProps;
+        PlayerState state;
+        float spawnX, spawnY;
+        Ladder* currentLadder;
+        float climbSpeed;
+        bool climbingMoving;
+        float stepUpTargetY;
+        float yVelocity;
+        bool grounded;
+        bool dead;
+    };
+
+    Snapshot saveSnapshot() const;
+
+    /**
+     * Restore a saved state. Cancels a running death animation.
+     * @param s State from saveSnapshot()
+     * @param ladderValid False if s.currentLadder no longer exists in the scene
+     */
+    void restoreSnapshot(const Snapshot& s, bool ladderValid);
+
+    /**
+     * True while the death animation is playing (state cannot be snapshotted)
+     */
+    bool isDying() const { return deathAction != nullptr; }
+
     // Setters
     void setPlaying(bool p) { playing = p; }
     void setLives(int l) { lives = l; }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <new>
 #include "gameobject.h"
 #include "../game/weapontype.h"
 #include "../core/collisionbox.h"
@@ -54,7 +56,14 @@ public:
 
     // Abstract interface - must be implemented by subclasses
     virtual void update(float dt) = 0;
-    virtual void draw(Graph* graph) = 0;
+    virtual void draw(Graph* graph, float alpha = 1.0f) = 0;  ///< alpha: render interpolation factor
+
+    /**
+     * Copy-construct the concrete shot into memory (an EntityPool slot, used
+     * by scene snapshots). The copy does not take over the original's audio
+     * channel.
+     */
+    virtual Shot* cloneInto(void* memory) const = 0;
 
     // Collision hooks - can be overridden by subclasses
     /**
@@ -0,0 +1,88 @@
+#include "ballkernel_simd.h"
+#include <SDL.h>
+
+// Implemented in simd_avx2.cpp
+bool simdHasAVX2Build();
+void ballKernelStepAVX2(const BallLanes& lanes, size_t count, float ticks);
+
+bool BallKernel::forceScalar = false;
+
+namespace
+{
+    bool useAVX2()
+    {
+        static const bool available = simdHasAVX2Build() && SDL_HasAVX2();
+        return available;
+    }
+}
+
+Uint32 BallKernel::add()
+{
+    Uint32 i = (Uint32)x.size();
+    x.push_back(0.0f); y.push_back(0.0f); time.push_back(0.0f); maxTime.push_back(0.0f);
+    y0.push_back(0.0f); gravity.push_back(0.0f); top.push_back(0.0f); diameter.push_back(0.0f);
+    dirX.push_back(1.0f); dirY.push_back(1.0f); moving.push_back(1.0f);
+    return i;
+}
+
+void BallKernel::removeAt(size_t i)
+{
+    for (std::vector<float>* lane : { &x, &y, &time, &maxTime, &y0, &gravity, &top, &diameter, &dirX, &dirY, &moving })
+    {
+        (*lane)[i] = lane->back();
+        lane->pop_back();
+    }
+}
+
+void BallKernel::clear()
+{
+    x.clear(); y.clear(); time.clear(); maxTime.clear(); y0.clear();
+    gravity.clear(); top.clear(); diameter.clear(); dirX.clear(); dirY.clear();
+    moving.clear();
+}
+
+BallLanes BallKernel::lanes()
+{
+    return { x.data(), y.data(), time.data(), maxTime.data(), y0.data(),
+             gravity.data(), top.data(), diameter.data(), dirX.data(), dirY.data(),
+             moving.data() };
+}
+
+void BallKernel::step(float dt)
+{
+    // Same expression as Ball::update()
+    float ticks = dt * GameState::GLOBAL_UPDATE_FRAMERATE;
+    BallLanes l = lanes();
+    size_t count = size();
+
+    if (forceScalar)
+    {
+        stepRange<PackScalar>(l, 0, count, ticks);
+        return;
+    }
+
+    if (useAVX2())
+    {
+        ballKernelStepAVX2(l, count, ticks);
+        return;
+    }
+
+#ifdef SIMDPACK_SSE2
+    stepRange<PackSSE2>(l, 0, count, ticks);
+#else
+    stepRange<PackScalar>(l, 0, count, ticks);
+#endif
+}
+
+const char* BallKernel::isaName()
+{
+    if (forceScalar)
+        return "scalar";
+    if (useAVX2())
+        return "AVX2";
+#ifdef SIMDPACK_SSE2
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+/**
+ * @struct BallMotion
+ * @brief Motion state of one ball (the fields Ball::update() reads and writes)
+ */
+struct BallMotion
+{
+    float x = 0.0f, y = 0.0f;
+    float time = 0.0f, maxTime = 0.0f;
+    float y0 = 0.0f;        // initial space
+    float gravity = 0.0f;   // acceleration (acc)
+    int top = 0;            // maximum height from the floor
+    int diameter = 0;
+    float dirX = 1.0f;      // horizontal direction (magnitude acts as speed multiplier)
+    int dirY = 1;           // vertical direction (-1=up, 1=down)
+};
+
+/**
+ * @struct BallLanes
+ * @brief Pointers to the per-field arrays of a BallKernel (one entry per ball)
+ *
+ * dirY is stored as a float (+1 / -1) so every field can be processed with
+ * the same float SIMD lanes. moving is 1 for balls step() advances and 0
+ * for balls it must leave in place (flashing).
+ */
+struct BallLanes
+{
+    float* x;
+    float* y;
+    float* time;
+    float* maxTime;
+    float* y0;
+    float* gravity;
+    float* top;
+    float* diameter;
+    float* dirX;
+    float* dirY;
+    float* moving;
+};
+
+/**
+ * @class BallKernel
+ * @brief Structure-of-arrays store of ball motion, updated in one vectorised loop
+ *
+ * Owns the motion state of every ball of a BallPool (see entitypools.h):
+ * lane i belongs to the pool's i-th ball, and Ball reads and writes its
+ * position and motion here instead of keeping copies. The pool keeps the
+ * lanes in its dense order (add() on emplace, removeAt() on erase).
+ *
+ * step() advances all balls at once: 8 lanes with AVX2 when the CPU
+ * supports it, 4 lanes with SSE2 otherwise, and a scalar loop on other
+ * architectures and for the remainder. Every lane runs the same float
+ * operations in the same order as Ball::update(), with branches turned
+ * into lane selects, so the results are bit-identical to the scalar path
+ * (/ballbench checks this). Lanes not marked moving keep their state.
+ */
+class BallKernel
+{
+public:
+    /// Below this many balls in the store the scalar Ball::update() loop is used
+    static constexpr size_t MIN_BATCH = 32;
+
+    /**
+     * @brief Append a lane (zero motion, moving)
+     * @return Index of the new lane
+     */
+    Uint32 add();
+
+    /**
+     * @brief Remove lane i (swap-and-pop, like EntityPool::erase())
+     */
+    void removeAt(size_t i);
+
+    void clear();
+    size_t size() const { return x.size(); }
+
+    BallMotion get(size_t i) const
+    {
+        BallMotion m;
+        m.x = x[i];
+        m.y = y[i];
+        m.time = time[i];
+        m.maxTime = maxTime[i];
+        m.y0 = y0[i];
+        m.gravity = gravity[i];
+        m.top = (int)top[i];
+        m.diameter = (int)diameter[i];
+        m.dirX = dirX[i];
+        m.dirY = (int)dirY[i];
+        return m;
+    }
+
+    void set(size_t i, const BallMotion& m)
+    {
+        x[i] = m.x;
+        y[i] = m.y;
+        time[i] = m.time;
+        maxTime[i] = m.maxTime;
+        y0[i] = m.y0;
+        gravity[i] = m.gravity;
+        top[i] = (float)m.top;
+        diameter[i] = (float)m.diameter;
+        dirX[i] = m.dirX;
+        dirY[i] = (float)m.dirY;
+    }
+
+    float getX(size_t i) const { return x[i]; }
+    float getY(size_t i) const { return y[i]; }
+    int getDiameter(size_t i) const { return (int)diameter[i]; }
+    void setX(size_t i, float v) { x[i] = v; }
+    void setY(size_t i, float v) { y[i] = v; }
+
+    /**
+     * @brief Include or exclude lane i from step()
+     */
+    void setMoving(size_t i, bool m) { moving[i] = m ? 1.0f : 0.0f; }
+
+    /**
+     * @brief Advance every moving ball by dt seconds
+     */
+    void step(float dt);
+
+    /// Lane pointers into the arrays (valid until the next add/removeAt/clear)
+    BallLanes lanes();
+
+    /**
+     * @brief Instruction set step() uses on this machine ("AVX2", "SSE2" or "scalar")
+     */
+    static const char* isaName();
+
+    /**
+     * @brief Force the scalar loop (benchmarks and equivalence checks)
+     */
+    static void setForceScalar(bool force) { forceScalar = force; }
+
+private:
+    std::vector<float> x, y, time, maxTime, y0, gravity, top, diameter, dirX, dirY, moving;
+
+    static bool forceScalar;
+};
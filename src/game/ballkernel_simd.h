@@ -0,0 +1,133 @@
+#pragma once
+
+// Private to ballkernel.cpp and simd_avx2.cpp (see simdpack.h).
+//
+// The ball step is instantiated for every pack type; lanes run the same
+// float operations in the same order as Ball::update(). Lanes that are
+// not moving keep their stored state.
+
+#include "simdpack.h"
+#include "ballkernel.h"
+#include "ball.h"
+#include "stage.h"
+#include "app.h"
+
+namespace
+{
+    /**
+     * Time at which the parabola reaches height h (Ball::timeAtHeight)
+     */
+    template<typename P>
+    inline typename P::F timeAtHeight(typename P::F h, typename P::F base, typename P::F y0, typename P::F gravity)
+    {
+        using F = typename P::F;
+        const F zero = P::set1(0.0f);
+        F d = P::sub(P::sub(h, base), y0);
+        F t = P::sqrt(P::div(P::mul(P::set1(2.0f), d), gravity));
+        return P::select(P::le(d, zero), zero, t);
+    }
+
+    /**
+     * Advance P::WIDTH balls starting at index i (mirrors Ball::update)
+     */
+    template<typename P>
+    inline void stepLanes(const BallLanes& L, size_t i, float ticksScalar)
+    {
+        using F = typename P::F;
+        using M = typename P::M;
+
+        const F zero = P::set1(0.0f);
+        const F one = P::set1(1.0f);
+        const F minusOne = P::set1(-1.0f);
+        const F two = P::set1(2.0f);
+        const F ticks = P::set1(ticksScalar);
+        const F minX = P::set1((float)Stage::MIN_X);
+        const F maxX = P::set1((float)Stage::MAX_X);
+        const F minY = P::set1((float)Stage::MIN_Y);
+        const F maxY1 = P::set1((float)(Stage::MAX_Y + 1));
+
+        const M moving = P::gt(P::load(L.moving + i), zero);
+
+        F diameter = P::load(L.diameter + i);
+        F top = P::load(L.top + i);
+
+        // Horizontal: constant speed, reflected off the side walls
+        F x = P::load(L.x + i);
+        F dirX = P::load(L.dirX + i);
+        x = P::add(x, P::mul(P::mul(dirX, P::set1(Ball::SPEED_X)), ticks));
+
+        M right = P::andm(P::gt(dirX, zero), P::ge(P::add(x, diameter), maxX));
+        M left = P::andm(P::lt(dirX, zero), P::le(x, minX));
+        x = P::select(right, P::sub(P::mul(two, P::sub(maxX, diameter)), x),
+            P::select(left, P::sub(P::mul(two, minX), x), x));
+        dirX = P::select(P::orm(right, left), P::mul(minusOne, dirX), dirX);
+
+        // Vertical: consume the step event by event
+        F time = P::load(L.time + i);
+        F maxTime = P::load(L.maxTime + i);
+        F y0 = P::load(L.y0 + i);
+        F gravity = P::load(L.gravity + i);
+        F dirY = P::load(L.dirY + i);
+
+        F base = P::sub(maxY1, top);        // (float)(MAX_Y - top + 1)
+        F floorY = P::sub(maxY1, diameter);  // (float)(MAX_Y + 1 - diameter)
+        F ceilY0 = P::sub(minY, base);
+        F remaining = ticks;
+
+        for (int events = 0; events < 4; events++)
+        {
+            M falling = P::eq(dirY, one);
+            M active = P::andm(P::andm(moving, P::gt(remaining, zero)), P::orm(falling, P::eq(dirY, minusOne)));
+            if (!P::any(active))
+                break;
+
+            F tFloor = timeAtHeight<P>(floorY, base, y0, gravity);
+            F tCeil = timeAtHeight<P>(minY, base, y0, gravity);
+
+            // No bounce within the remaining step: just advance time
+            M noHit = P::selectm(falling,
+                P::lt(P::add(time, remaining), tFloor),
+                P::gt(P::sub(time, remaining), tCeil));
+            F timeNoHit = P::select(falling, P::add(time, remaining), P::sub(time, remaining));
+
+            // Bounce: floor (falling) or apex/ceiling (rising)
+            F consumed = P::select(falling,
+                P::max(P::sub(tFloor, time), zero),
+                P::max(P::sub(time, tCeil), zero));
+            F timeHit = P::select(falling, maxTime, zero);
+            F y0Hit = P::select(falling, zero, P::select(P::gt(tCeil, zero), ceilY0, y0));
+            F dirYHit = P::select(falling, minusOne, one);
+
+            M go = P::andm(active, noHit);
+            M hit = P::andnotm(noHit, active);
+
+            time = P::select(go, timeNoHit, P::select(hit, timeHit, time));
+            remaining = P::select(go, zero, P::select(hit, P::sub(remaining, consumed), remaining));
+            y0 = P::select(hit, y0Hit, y0);
+            dirY = P::select(hit, dirYHit, dirY);
+        }
+
+        F y = P::add(base, P::add(y0, P::mul(P::mul(P::set1(0.5f), gravity), P::mul(time, time))));
+
+        // time, y0 and dirY only change in moving lanes (see active)
+        P::store(L.x + i, P::select(moving, x, P::load(L.x + i)));
+        P::store(L.y + i, P::select(moving, y, P::load(L.y + i)));
+        P::store(L.dirX + i, P::select(moving, dirX, P::load(L.dirX + i)));
+        P::store(L.dirY + i, dirY);
+        P::store(L.time + i, time);
+        P::store(L.y0 + i, y0);
+    }
+
+    /**
+     * Advance balls [begin, end) with pack P, finishing the remainder with scalars
+     */
+    template<typename P>
+    inline void stepRange(const BallLanes& L, size_t begin, size_t end, float ticks)
+    {
+        size_t i = begin;
+        for (; i + P::WIDTH <= end; i += P::WIDTH)
+            stepLanes<P>(L, i, ticks);
+        for (; i < end; i++)
+            stepLanes<PackScalar>(L, i, ticks);
+    }
+}
@@ -0,0 +1,19 @@
+#include "benchutil.h"
+#include "stage.h"
+
+void BenchUtil::spawnRandomBalls(BallPool& pool, Scene* scene, int count, Random& rng)
+{
+    const int largest = Ball::defaultDiameter(0);
+    for (int i = 0; i < count; i++)
+    {
+        int x = rng.range(Stage::MIN_X, Stage::MAX_X - largest + 1);
+        int y = rng.range(Stage::MIN_Y, Stage::MAX_Y - largest + 1);
+        int size = rng.range(0, 4);
+        pool.emplace(scene, x, y, size, (i & 1) ? 1.0f : -1.0f, (i & 2) ? 1 : -1);
+    }
+}
+
+double BenchUtil::elapsedUs(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / (double)SDL_GetPerformanceFrequency();
+}
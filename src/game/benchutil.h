@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <SDL.h>
+#include "entitypools.h"
+#include "../core/random.h"
+
+class Scene;
+
+/**
+ * @class BenchUtil
+ * @brief Setup and timing shared by the benchmarks (debug console commands, CollisionStress)
+ *
+ * Benchmarks draw their worlds from Random seeded with SEED, so a run is
+ * the same on every compiler and standard library (std:: distributions
+ * are not), and two paths compared by one benchmark see the same input.
+ */
+class BenchUtil
+{
+public:
+    /// Seed of every benchmark world
+    static constexpr uint64_t SEED = 12345;
+
+    /**
+     * @brief Emplace count balls of random size at random positions in the playfield
+     *
+     * Positions leave room for the largest ball; horizontal and vertical
+     * directions alternate with the ball index.
+     */
+    static void spawnRandomBalls(BallPool& pool, Scene* scene, int count, Random& rng);
+
+    /**
+     * @brief Microseconds since a SDL_GetPerformanceCounter() value
+     */
+    static double elapsedUs(Uint64 start);
+
+    /**
+     * @brief Log suffix of an equivalence check: "  identical" when nothing differs
+     */
+    static const char* identicalSuffix(int mismatches) { return mismatches ? "" : "  identical"; }
+};
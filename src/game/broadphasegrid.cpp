@@ -0,0 +1,83 @@
+#include "broadphasegrid.h"
+#include <algorithm>
+
+BroadphaseGrid::CellRange BroadphaseGrid::toCellRange(const CollisionBox& box)
+{
+    // Normalize so degenerate/negative extents still map to a valid range
+    int x0 = std::min(box.x, box.x + box.w) - Stage::MIN_X;
+    int x1 = std::max(box.x, box.x + box.w) - Stage::MIN_X;
+    int y0 = std::min(box.y, box.y + box.h) - Stage::MIN_Y;
+    int y1 = std::max(box.y, box.y + box.h) - Stage::MIN_Y;
+
+    CellRange r;
+    r.c0 = std::max(0, std::min(COLS - 1, x0 / CELL_SIZE));
+    r.c1 = std::max(0, std::min(COLS - 1, x1 / CELL_SIZE));
+    r.r0 = std::max(0, std::min(ROWS - 1, y0 / CELL_SIZE));
+    r.r1 = std::max(0, std::min(ROWS - 1, y1 / CELL_SIZE));
+    return r;
+}
+
+void BroadphaseGrid::begin()
+{
+    pending.clear();
+}
+
+void BroadphaseGrid::add(int index, const CollisionBox& box)
+{
+    pending.push_back({ index, toCellRange(box) });
+}
+
+void BroadphaseGrid::build()
+{
+    // Counting pass
+    cellStart.assign(CELL_COUNT + 1, 0);
+    for (const PendingItem& p : pending)
+    {
+        for (int r = p.range.r0; r <= p.range.r1; r++)
+            for (int c = p.range.c0; c <= p.range.c1; c++)
+                cellStart[r * COLS + c + 1]++;
+    }
+
+    // Prefix sum -> cell offsets
+    for (int i = 0; i < CELL_COUNT; i++)
+        cellStart[i + 1] += cellStart[i];
+
+    // Fill pass. Items are visited in add() order, so each cell bucket
+    // stays sorted by index when callers add in list order.
+    items.resize(cellStart[CELL_COUNT]);
+    fillCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (const PendingItem& p : pending)
+    {
+        for (int r = p.range.r0; r <= p.range.r1; r++)
+            for (int c = p.range.c0; c <= p.range.c1; c++)
+                items[fillCursor[r * COLS + c]++] = p.index;
+    }
+}
+
+void BroadphaseGrid::query(const CollisionBox& box, std::vector<int>& out) const
+{
+    out.clear();
+    if (items.empty()) return;
+
+    CellRange range = toCellRange(box);
+    for (int r = range.r0; r <= range.r1; r++)
+    {
+        for (int c = range.c0; c <= range.c1; c++)
+        {
+            int cell = r * COLS + c;
+            out.insert(out.end(), items.begin() + cellStart[cell], items.begin() + cellStart[cell + 1]);
+        }
+    }
+
+    // A single cell is already sorted and duplicate-free
+    if (range.r0 != range.r1 || range.c0 != range.c1)
+    {
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+}
+
+void BroadphaseGrid::queryCircle(int cx, int cy, int radius, std::vector<int>& out) const
+{
+    query({ cx - radius, cy - radius, radius * 2, radius * 2 }, out);
+}
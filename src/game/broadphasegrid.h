@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+#include "../core/collisionbox.h"
+#include "stage.h"
+
+/**
+ * @class BroadphaseGrid
+ * @brief Uniform grid over the playfield used to cull collision candidates
+ *
+ * Items are registered by their index in the caller's entity list together
+ * with their collision box. Each item is stored in every cell its box
+ * touches. Queries return the indices of all items sharing a cell with the
+ * query box, sorted ascending and without duplicates, so callers iterating
+ * the result visit entities in the same order as the original list.
+ *
+ * Coordinates outside Stage::MIN_X..MAX_X / MIN_Y..MAX_Y are clamped to
+ * the border cells, so off-field objects are still found (just less culled).
+ *
+ * Cell ranges are inclusive on both ends (box.x .. box.x + box.w), matching
+ * circleIntersectsBox() which treats the far edge as part of the box.
+ *
+ * Storage is a flat bucket array (cell offsets + item indices), rebuilt
+ * from scratch with begin()/add()/build(). Buffers keep their capacity
+ * between rebuilds.
+ */
+class BroadphaseGrid
+{
+public:
+    static constexpr int CELL_SIZE = 32;   ///< Cell edge in pixels
+    static constexpr int COLS = (Stage::MAX_X - Stage::MIN_X) / CELL_SIZE + 1;
+    static constexpr int ROWS = (Stage::MAX_Y - Stage::MIN_Y) / CELL_SIZE + 1;
+    static constexpr int CELL_COUNT = COLS * ROWS;
+
+    BroadphaseGrid() = default;
+
+    /**
+     * @brief Start a new rebuild, discarding previously added items
+     */
+    void begin();
+
+    /**
+     * @brief Register an item for the current rebuild
+     * @param index Item index in the caller's list (must be >= 0)
+     * @param box Item collision box
+     */
+    void add(int index, const CollisionBox& box);
+
+    /**
+     * @brief Finish the rebuild and bucket all added items into cells
+     */
+    void build();
+
+    /**
+     * @brief Collect candidate items overlapping an axis-aligned box
+     * @param box Query box (inclusive on both ends)
+     * @param out Receives sorted, unique item indices (cleared first)
+     */
+    void query(const CollisionBox& box, std::vector<int>& out) const;
+
+    /**
+     * @brief Collect candidate items overlapping a circle's bounding box
+     * @param cx Circle center x
+     * @param cy Circle center y
+     * @param radius Circle radius
+     * @param out Receives sorted, unique item indices (cleared first)
+     */
+    void queryCircle(int cx, int cy, int radius, std::vector<int>& out) const;
+
+    int getItemCount() const { return (int)pending.size(); }
+
+private:
+    struct CellRange
+    {
+        int c0, r0, c1, r1;
+    };
+
+    struct PendingItem
+    {
+        int index;
+        CellRange range;
+    };
+
+    static CellRange toCellRange(const CollisionBox& box);
+
+    std::vector<PendingItem> pending;   ///< Items added since begin()
+    std::vector<int> cellStart;         ///< Offset of each cell in items (CELL_COUNT + 1 entries)
+    std::vector<int> items;             ///< Item indices bucketed by cell
+    std::vector<int> fillCursor;        ///< Per-cell write cursor used by build()
+};
@@ -0,0 +1,101 @@
+#include "circlebatch.h"
+#include "circlebatch_simd.h"
+
+// Implemented in simd_avx2.cpp
+bool simdHasAVX2Build();
+void circleBatchIntersectAVX2(const float* cx, const float* cy, const float* radius, size_t count,
+                              float x0, float y0, float x1, float y1, Uint32* mask);
+
+bool CircleBatch::forceScalar = false;
+
+namespace
+{
+    bool useAVX2()
+    {
+        static const bool available = simdHasAVX2Build() && SDL_HasAVX2();
+        return available;
+    }
+}
+
+void CircleBatch::clear()
+{
+    cx.clear();
+    cy.clear();
+    radius.clear();
+}
+
+void CircleBatch::reserve(size_t count)
+{
+    cx.reserve(count);
+    cy.reserve(count);
+    radius.reserve(count);
+}
+
+void CircleBatch::add(int x, int y, int r)
+{
+    cx.push_back((float)x);
+    cy.push_back((float)y);
+    radius.push_back((float)r);
+}
+
+void CircleBatch::gather(const CircleBatch& source, const std::vector<int>& indices)
+{
+    cx.resize(indices.size());
+    cy.resize(indices.size());
+    radius.resize(indices.size());
+
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        int src = indices[i];
+        cx[i] = source.cx[src];
+        cy[i] = source.cy[src];
+        radius[i] = source.radius[src];
+    }
+}
+
+bool CircleBatch::intersectBox(const CollisionBox& box, std::vector<Uint32>& mask) const
+{
+    size_t count = size();
+    mask.assign((count + 31) / 32, 0);
+    if (count == 0)
+        return false;
+
+    // Far edges are computed in integers first, like circleIntersectsBox()
+    float x0 = (float)box.x;
+    float y0 = (float)box.y;
+    float x1 = (float)(box.x + box.w);
+    float y1 = (float)(box.y + box.h);
+
+    if (forceScalar)
+        intersectRange<PackScalar>(cx.data(), cy.data(), radius.data(), count, x0, y0, x1, y1, mask.data());
+    else if (useAVX2())
+        circleBatchIntersectAVX2(cx.data(), cy.data(), radius.data(), count, x0, y0, x1, y1, mask.data());
+    else
+    {
+#ifdef SIMDPACK_SSE2
+        intersectRange<PackSSE2>(cx.data(), cy.data(), radius.data(), count, x0, y0, x1, y1, mask.data());
+#else
+        intersectRange<PackScalar>(cx.data(), cy.data(), radius.data(), count, x0, y0, x1, y1, mask.data());
+#endif
+    }
+
+    for (Uint32 word : mask)
+    {
+        if (word)
+            return true;
+    }
+    return false;
+}
+
+const char* CircleBatch::isaName()
+{
+    if (forceScalar)
+        return "scalar";
+    if (useAVX2())
+        return "AVX2";
+#ifdef SIMDPACK_SSE2
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
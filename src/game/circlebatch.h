@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+#include "../core/collisionbox.h"
+
+/**
+ * @class CircleBatch
+ * @brief Packed circles tested against one box at a time with SIMD
+ *
+ * Holds circle centers and radii in separate float arrays and tests all of
+ * them against a CollisionBox in one vectorised loop: 8 lanes with AVX2
+ * when the CPU supports it, 4 lanes with SSE2 otherwise, and a scalar loop
+ * on other architectures and for the remainder.
+ *
+ * The result is a hit mask with one bit per circle, so callers only run
+ * the expensive follow-up work (getCircleBoxCollisionSide, contacts) for
+ * the circles that actually hit.
+ *
+ * Each lane performs the same clamp / distance test as circleIntersectsBox()
+ * on exact integer values stored in floats. Products stay exact while
+ * |dx| and |dy| are at most MAX_EXACT_OFFSET, which covers the playfield;
+ * farther circles miss either way as long as their radius is smaller.
+ * /circlebench checks the batch against circleIntersectsBox().
+ */
+class CircleBatch
+{
+public:
+    /// Largest center-to-box offset for which the float test is exact
+    static constexpr int MAX_EXACT_OFFSET = 2048;
+
+    void clear();
+    void reserve(size_t count);
+    size_t size() const { return cx.size(); }
+
+    /**
+     * @brief Append a circle (integer center and radius, as used by the entities)
+     */
+    void add(int x, int y, int radius);
+
+    /**
+     * @brief Replace the contents with a subset of another batch
+     * @param source Batch to copy circles from
+     * @param indices Indices into source, in the order to store them
+     */
+    void gather(const CircleBatch& source, const std::vector<int>& indices);
+
+    /**
+     * @brief Test every circle against a box
+     * @param box Box to test (inclusive far edges, like circleIntersectsBox)
+     * @param mask Receives one bit per circle: bit (i % 32) of word i / 32
+     * @return true if at least one circle hits
+     */
+    bool intersectBox(const CollisionBox& box, std::vector<Uint32>& mask) const;
+
+    /**
+     * @brief Call f(index) for every set bit of a hit mask, in ascending order
+     */
+    template<typename F>
+    static void forEachHit(const std::vector<Uint32>& mask, F f)
+    {
+        for (size_t w = 0; w < mask.size(); w++)
+        {
+            Uint32 bits = mask[w];
+            for (int b = 0; bits; b++, bits >>= 1)
+            {
+                if (bits & 1u)
+                    f(w * 32 + b);
+            }
+        }
+    }
+
+    /**
+     * @brief Instruction set intersectBox() uses on this machine ("AVX2", "SSE2" or "scalar")
+     */
+    static const char* isaName();
+
+    /**
+     * @brief Force the scalar loop (benchmarks and equivalence checks)
+     */
+    static void setForceScalar(bool force) { forceScalar = force; }
+
+private:
+    std::vector<float> cx, cy, radius;
+
+    static bool forceScalar;
+};
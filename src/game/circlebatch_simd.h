@@ -0,0 +1,58 @@
+#pragma once
+
+// Private to circlebatch.cpp and simd_avx2.cpp (see simdpack.h).
+//
+// The circle-vs-box test is instantiated for every pack type; lanes run
+// the same clamp and distance test as circleIntersectsBox().
+
+#include <SDL.h>
+#include "simdpack.h"
+
+namespace
+{
+    /**
+     * Test P::WIDTH circles starting at index i against a box
+     * @return One bit per lane (lane 0 = bit 0)
+     */
+    template<typename P>
+    inline int intersectLanes(const float* cx, const float* cy, const float* radius, size_t i,
+                              float x0, float y0, float x1, float y1)
+    {
+        using F = typename P::F;
+
+        const F bx0 = P::set1(x0);
+        const F by0 = P::set1(y0);
+        const F bx1 = P::set1(x1);
+        const F by1 = P::set1(y1);
+
+        F x = P::load(cx + i);
+        F y = P::load(cy + i);
+        F r = P::load(radius + i);
+
+        // Closest point of the box, clamped the same way as circleIntersectsBox()
+        F closestX = P::select(P::lt(x, bx0), bx0, P::select(P::gt(x, bx1), bx1, x));
+        F closestY = P::select(P::lt(y, by0), by0, P::select(P::gt(y, by1), by1, y));
+
+        F dx = P::sub(x, closestX);
+        F dy = P::sub(y, closestY);
+        F distSq = P::add(P::mul(dx, dx), P::mul(dy, dy));
+
+        return P::bits(P::le(distSq, P::mul(r, r)));
+    }
+
+    /**
+     * Test circles [0, count) with pack P, finishing the remainder with scalars
+     * mask must hold (count + 31) / 32 zeroed words.
+     */
+    template<typename P>
+    inline void intersectRange(const float* cx, const float* cy, const float* radius, size_t count,
+                               float x0, float y0, float x1, float y1, Uint32* mask)
+    {
+        // Pack widths divide 32, so a pack never straddles two mask words
+        size_t i = 0;
+        for (; i + P::WIDTH <= count; i += P::WIDTH)
+            mask[i / 32] |= (Uint32)intersectLanes<P>(cx, cy, radius, i, x0, y0, x1, y1) << (i % 32);
+        for (; i < count; i++)
+            mask[i / 32] |= (Uint32)intersectLanes<PackScalar>(cx, cy, radius, i, x0, y0, x1, y1) << (i % 32);
+    }
+}
@@ -11,29 +11,53 @@
 
 void CollisionRules::processContacts(const ContactList& contacts, Scene* scene)
 {
+    // Pooled entities are looked up through their handles, so an entity
+    // removed since detection is skipped instead of dereferenced
     for (const Contact& c : contacts)
     {
         switch (c.type)
         {
             case ContactType::BallShot:
-                handleBallShot(c.getBall(), c.getShot());
+            {
+                Ball* ball = scene->lsBalls.get(c.handleA);
+                Shot* shot = scene->lsShoots.get(c.handleB);
+                if (ball && shot)
+                    handleBallShot(ball, shot);
                 break;
+            }
 
             case ContactType::BallPlayer:
-                handleBallPlayer(c.getBall(), c.getPlayer(), scene);
+            {
+                Ball* ball = scene->lsBalls.get(c.handleA);
+                if (ball)
+                    handleBallPlayer(ball, c.getPlayer(), scene);
                 break;
+            }
 
             case ContactType::HexaShot:
-                handleHexaShot(c.getHexa(), c.getShot());
+            {
+                Hexa* hexa = scene->lsHexas.get(c.handleA);
+                Shot* shot = scene->lsShoots.get(c.handleB);
+                if (hexa && shot)
+                    handleHexaShot(hexa, shot);
                 break;
+            }
 
             case ContactType::HexaPlayer:
-                handleHexaPlayer(c.getHexa(), c.getPlayer(), scene);
+            {
+                Hexa* hexa = scene->lsHexas.get(c.handleA);
+                if (hexa)
+                    handleHexaPlayer(hexa, c.getPlayer(), scene);
                 break;
+            }
 
             case ContactType::ShotFloor:
-                handleShotFloor(c.getShot(), c.getPlatform());
+            {
+                Shot* shot = scene->lsShoots.get(c.handleA);
+                if (shot)
+                    handleShotFloor(shot, c.getPlatform(), scene);
                 break;
+            }
 
             case ContactType::BallFloor:
             case ContactType::HexaFloor:
@@ -42,8 +66,12 @@ void CollisionRules::processContacts(const ContactList& contacts, Scene* scene)
                 break;
 
             case ContactType::PickupPlayer:
-                handlePickupPlayer(c.getPickup(), c.getPlayer());
+            {
+                Pickup* pickup = scene->lsPickups.get(c.handleA);
+                if (pickup)
+                    handlePickupPlayer(pickup, c.getPlayer());
                 break;
+            }
         }
     }
 }
@@ -99,7 +127,7 @@ void CollisionRules::handleBallPlayer(Ball* ball, Player* player, Scene* scene)
     player->kill();
 }
 
-void CollisionRules::handleShotFloor(Shot* shot, Platform* platform)
+void CollisionRules::handleShotFloor(Shot* shot, Platform* platform, Scene* scene)
 {
     // Skip if shot already dead
     if (shot->isDead()) return;
@@ -108,7 +136,17 @@ void CollisionRules::handleShotFloor(Shot* shot, Platform* platform)
     shot->onFloorHit(platform);
 
     // Advance glass damage state (no-op for regular floors)
+    bool wasInvisible = platform->isInvisible();
+    bool wasAnimating = platform->isAnimating();
     platform->onHit();
+
+    // A revealed floor becomes solid geometry
+    if (wasInvisible && !platform->isInvisible())
+        scene->invalidatePlatformIndex();
+
+    // Revealed, or breaking glass leaving the cached layer to animate live
+    if (wasInvisible != platform->isInvisible() || wasAnimating != platform->isAnimating())
+        scene->invalidateStaticLayer(platform);
 }
 
 void CollisionRules::handlePickupPlayer(Pickup* pickup, Player* player)
@@ -30,6 +30,11 @@ class CollisionRules
 public:
     /**
      * @brief Process all contacts from this frame
+     *
+     * Balls, hexas, shots and pickups are resolved from the contact's pool
+     * handles in the scene's pools; contacts whose entity no longer exists
+     * are ignored.
+     *
      * @param contacts List of collisions detected by CollisionSystem
      * @param scene Scene context for accessing entities and firing events
      */
@@ -60,8 +65,9 @@ private:
      *
      * - Calls shot->onFloorHit() for weapon-specific behavior
      * - Calls platform->onHit() to degrade Glass (no-op for Floor)
+     * - Invalidates the scene's platform index if the hit revealed an invisible floor
      */
-    void handleShotFloor(Shot* shot, Platform* platform);
+    void handleShotFloor(Shot* shot, Platform* platform, Scene* scene);
 
     /**
      * @brief Handle pickup-player collision
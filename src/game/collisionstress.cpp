@@ -0,0 +1,280 @@
+#include "collisionstress.h"
+#include "benchutil.h"
+#include "collisionsystem.h"
+#include "circlebatch.h"
+#include "platform.h"
+#include "stage.h"
+#include "../entities/player.h"
+#include "../entities/shot.h"
+#include "../core/alloccounter.h"
+#include "../core/logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+    // Box sizes of the stock sprites (floor.json, glass.json, gun_bullet.json,
+    // harpoon/claw chains, player frames), fixed so no resources are needed
+    const int FLOOR_W = 48, FLOOR_H = 16;       // FloorType::HORIZ_MIDDLE
+    const int GLASS_W = 16, GLASS_H = 16;       // GlassType::SMALL
+    const int CHAIN_W = 16;
+    const int BULLET_W = 8, BULLET_H = 8;
+    const int PLAYER_W = 24, PLAYER_H = 32;
+
+    /// Platform with an explicit box; "glass" ones are destructible like Glass
+    class StressPlatform : public Platform
+    {
+        int w, h;
+        bool destructible;
+
+    public:
+        StressPlatform(int x, int y, int w, int h, bool destructible)
+            : w(w), h(h), destructible(destructible)
+        {
+            xPos = (float)x;
+            yPos = (float)y;
+        }
+
+        int getWidth() const override { return w; }
+        int getHeight() const override { return h; }
+        bool isDestructible() const override { return destructible; }
+        Sprite* getCurrentSprite() const override { return nullptr; }
+        std::unique_ptr<Platform> clone() const override { return std::make_unique<StressPlatform>(*this); }
+    };
+
+    /// Shot with explicit boxes: chains reach from the tip down to the
+    /// player's feet and only hit floors above the gun, like HarpoonShot/ClawShot
+    class StressShot : public Shot
+    {
+        CollisionBox box;
+        CollisionBox floorBox;
+
+    public:
+        StressShot(Player* pl, WeaponType type, const CollisionBox& box)
+            : Shot(nullptr, pl, type), box(box), floorBox(box)
+        {
+            if (type != WeaponType::GUN)
+                floorBox.h = std::max(1, (int)gunY - box.y);
+        }
+
+        void update(float dt) override {}
+        void draw(Graph* graph, float alpha) override {}
+        Shot* cloneInto(void* memory) const override { return new (memory) StressShot(*this); }
+        CollisionBox getCollisionBox() const override { return box; }
+        CollisionBox getFloorCollisionBox() const override { return floorBox; }
+    };
+
+    /// Player standing at its spawn position with an explicit box
+    class StressPlayer : public Player
+    {
+    public:
+        explicit StressPlayer(int id) : Player(id) {}
+
+        CollisionBox getCollisionBox() const override
+        {
+            return { (int)getX() - PLAYER_W / 2, (int)getY() - PLAYER_H, PLAYER_W, PLAYER_H };
+        }
+    };
+}
+
+std::vector<CollisionStress::Scenario> CollisionStress::defaultScenarios()
+{
+    static const int BALL_COUNTS[] = { 100, 1000, 5000 };
+    static const int PLATFORM_COUNTS[] = { 16, 64 };
+
+    std::vector<Scenario> scenarios;
+    for (Layout layout : { Layout::GRID, Layout::RANDOM })
+    {
+        for (int platforms : PLATFORM_COUNTS)
+        {
+            for (int balls : BALL_COUNTS)
+            {
+                Scenario s;
+                s.layout = layout;
+                s.balls = balls;
+                s.platforms = platforms;
+                s.shotsPerWeapon = 8;
+                scenarios.push_back(s);
+            }
+        }
+    }
+    return scenarios;
+}
+
+CollisionStress::Result CollisionStress::run(const Scenario& scenario, int ticks, Player* const players[2])
+{
+    Result result;
+    result.scenario = scenario;
+    result.ticks = ticks;
+
+    Random rng(BenchUtil::SEED);
+    auto randX = [&]() { return rng.range(Stage::MIN_X, Stage::MAX_X - 63); };
+    auto randY = [&]() { return rng.range(Stage::MIN_Y, Stage::MAX_Y - 63); };
+
+    // Platforms: alternate solid floors and small glass blocks
+    std::list<std::unique_ptr<Platform>> floors;
+    int cols = std::max(1, (int)std::ceil(std::sqrt((double)scenario.platforms * 2.0)));
+    int rows = std::max(1, (scenario.platforms + cols - 1) / cols);
+    int cellW = (Stage::MAX_X - Stage::MIN_X) / cols;
+    int cellH = (Stage::MAX_Y - Stage::MIN_Y) / (rows + 1);
+    for (int i = 0; i < scenario.platforms; i++)
+    {
+        int x, y;
+        if (scenario.layout == Layout::GRID)
+        {
+            x = Stage::MIN_X + (i % cols) * cellW;
+            y = Stage::MIN_Y + (i / cols + 1) * cellH;
+        }
+        else
+        {
+            x = randX();
+            y = randY();
+        }
+
+        if (i & 1)
+            floors.push_back(std::make_unique<StressPlatform>(x, y, GLASS_W, GLASS_H, true));
+        else
+            floors.push_back(std::make_unique<StressPlatform>(x, y, FLOOR_W, FLOOR_H, false));
+    }
+
+    BallPool balls;
+    HexaPool hexas;
+    ShotPool shots;
+    PickupPool pickups;
+    BenchUtil::spawnRandomBalls(balls, nullptr, scenario.balls, rng);
+
+    result.players = 2;
+
+    // Shots alternate between the players and are spread along X; chains
+    // run from a random tip height down to the floor
+    for (int i = 0; i < scenario.shotsPerWeapon; i++)
+    {
+        Player* owner = players[i & 1];
+
+        int tipY = randY();
+        shots.emplace<StressShot>(owner, WeaponType::HARPOON, CollisionBox{ randX(), tipY, CHAIN_W, Stage::MAX_Y - tipY });
+        shots.emplace<StressShot>(owner, WeaponType::GUN, CollisionBox{ randX(), randY(), BULLET_W, BULLET_H });
+        tipY = randY();
+        shots.emplace<StressShot>(owner, WeaponType::CLAW, CollisionBox{ randX(), tipY, CHAIN_W, Stage::MAX_Y - tipY });
+    }
+    result.shots = (int)shots.size();
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s_%db_%dp_%ds",
+                  scenario.layout == Layout::GRID ? "grid" : "random",
+                  scenario.balls, scenario.platforms, result.shots);
+    result.name = name;
+
+    CollisionSystem system;
+    CollisionSystem::Context ctx = { balls, hexas, shots, floors, pickups, { players[0], players[1] }, true };
+
+    // Resolution only changes ball directions here (fresh balls have no
+    // step start, so there are no swept bounces that would move them)
+    struct BallDir { float x; int y; };
+    std::vector<BallDir> initialDirs;
+    initialDirs.reserve(balls.size());
+    for (Ball* b : balls)
+        initialDirs.push_back({ b->getDirX(), b->getDirY() });
+    auto resetWorld = [&]()
+    {
+        for (size_t i = 0; i < balls.size(); i++)
+        {
+            balls[i]->setDirX(initialDirs[i].x);
+            balls[i]->setDirY(initialDirs[i].y);
+        }
+    };
+
+    // The first call grows the system's buffers; only steady state is measured
+    system.detectAndResolve(ctx);
+    system.resetAllocStats();
+
+    size_t totalContacts = 0;
+    Uint64 elapsed = 0;
+    for (int t = 0; t < ticks; t++)
+    {
+        resetWorld();
+        Uint64 start = SDL_GetPerformanceCounter();
+        totalContacts += system.detectAndResolve(ctx).size();
+        elapsed += SDL_GetPerformanceCounter() - start;
+    }
+    double seconds = (double)elapsed / (double)SDL_GetPerformanceFrequency();
+
+    result.nsPerCall = seconds * 1e9 / ticks;
+    result.contactsPerTick = (double)totalContacts / ticks;
+    result.contactsPerSecond = seconds > 0.0 ? (double)totalContacts / seconds : 0.0;
+    if (AllocCounter::isEnabled())
+        result.allocsPerTick = (double)system.getAllocStats().allocations / ticks;
+
+    return result;
+}
+
+bool CollisionStress::runAll(int ticks, const std::string& path)
+{
+    LOG_INFO("=== Collision stress: %d ticks per scenario, SIMD path %s ===", ticks, CircleBatch::isaName());
+
+    // Built once: constructing a Player loads its animations
+    StressPlayer player1(0), player2(1);
+    Player* const players[2] = { &player1, &player2 };
+
+    std::vector<Result> results;
+    for (const Scenario& scenario : defaultScenarios())
+    {
+        Result r = run(scenario, ticks, players);
+        char allocs[32];
+        if (r.allocsPerTick >= 0.0)
+            std::snprintf(allocs, sizeof(allocs), "%.2f", r.allocsPerTick);
+        else
+            std::snprintf(allocs, sizeof(allocs), "n/a");
+        LOG_INFO("  %-22s %10.0f ns/call  %8.1f contacts/tick  %12.0f contacts/s  allocs/tick %s",
+                 r.name.c_str(), r.nsPerCall, r.contactsPerTick, r.contactsPerSecond, allocs);
+        results.push_back(r);
+    }
+
+    if (!writeJson(path, results))
+    {
+        LOG_ERROR("Could not write %s", path.c_str());
+        return false;
+    }
+    LOG_SUCCESS("Results written to %s", path.c_str());
+    return true;
+}
+
+bool CollisionStress::writeJson(const std::string& path, const std::vector<Result>& results)
+{
+    FILE* fp = fopen(path.c_str(), "w");
+    if (!fp)
+        return false;
+
+#ifdef _DEBUG
+    const char* build = "Debug";
+#else
+    const char* build = "Release";
+#endif
+
+    std::fprintf(fp, "{\n");
+    std::fprintf(fp, "  \"benchmark\": \"collision_stress\",\n");
+    std::fprintf(fp, "  \"build\": \"%s\",\n", build);
+    std::fprintf(fp, "  \"simd\": \"%s\",\n", CircleBatch::isaName());
+    std::fprintf(fp, "  \"scenarios\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result& r = results[i];
+        std::fprintf(fp, "    {\"name\": \"%s\", \"layout\": \"%s\", \"balls\": %d, \"platforms\": %d, "
+                         "\"shots\": %d, \"players\": %d, \"ticks\": %d, ",
+                     r.name.c_str(), r.scenario.layout == Layout::GRID ? "grid" : "random",
+                     r.scenario.balls, r.scenario.platforms, r.shots, r.players, r.ticks);
+        std::fprintf(fp, "\"ns_per_call\": %.1f, \"contacts_per_tick\": %.2f, \"contacts_per_sec\": %.0f, ",
+                     r.nsPerCall, r.contactsPerTick, r.contactsPerSecond);
+        if (r.allocsPerTick >= 0.0)
+            std::fprintf(fp, "\"allocs_per_tick\": %.3f}", r.allocsPerTick);
+        else
+            std::fprintf(fp, "\"allocs_per_tick\": null}");
+        std::fprintf(fp, "%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(fp, "  ]\n}\n");
+
+    bool ok = std::ferror(fp) == 0;
+    fclose(fp);
+    return ok;
+}
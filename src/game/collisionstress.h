@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+class Player;
+
+/**
+ * @class CollisionStress
+ * @brief Synthetic-world stress benchmark for CollisionSystem::detectAndResolve
+ *
+ * Each scenario builds its own entity pools and platform list (balls of
+ * mixed sizes, platforms on a grid or at random, harpoon/gun/claw shots and
+ * two players) from a fixed seed, so runs are comparable across builds and
+ * commits. Nothing depends on loaded sprites: balls use
+ * Ball::defaultDiameter(), and platforms, shots and players are stand-ins
+ * with explicit boxes, so the same worlds are built in the game and in the
+ * standalone boing_collision_bench executable.
+ *
+ * Resolution flips ball directions, so every timed call starts from the
+ * same world: the ball directions are reset before each call, outside the
+ * timed section. Otherwise the measured worlds would drift and oscillate
+ * from tick to tick.
+ *
+ * Results can be written as JSON for regression tracking (see writeJson()).
+ * Run from the console with /collstress, or non-interactively with
+ * boing_collision_bench [--ticks N] [FILE].
+ */
+class CollisionStress
+{
+public:
+    enum class Layout
+    {
+        GRID,       ///< Platforms on a regular grid
+        RANDOM      ///< Platforms at random positions
+    };
+
+    struct Scenario
+    {
+        Layout layout = Layout::GRID;
+        int balls = 0;
+        int platforms = 0;
+        int shotsPerWeapon = 0;     ///< Shots of each weapon type (harpoon, gun, claw)
+    };
+
+    struct Result
+    {
+        Scenario scenario;
+        std::string name;           ///< e.g. "grid_1000b_64p_24s"
+        int shots = 0;
+        int players = 0;
+        int ticks = 0;
+        double nsPerCall = 0.0;             ///< Mean detectAndResolve time
+        double contactsPerTick = 0.0;
+        double contactsPerSecond = 0.0;     ///< Contacts produced per second of detectAndResolve time
+        double allocsPerTick = -1.0;        ///< Steady-state heap allocations (-1 without AllocCounter)
+    };
+
+    /**
+     * @brief Default scenario matrix (100..5000 balls, both layouts)
+     */
+    static std::vector<Scenario> defaultScenarios();
+
+    /**
+     * @brief Build the scenario's world and time detectAndResolve over it
+     * @param scenario World to build
+     * @param ticks Timed calls (after one warm-up call)
+     * @param players The two players: they fire the shots and are tested against every ball
+     */
+    static Result run(const Scenario& scenario, int ticks, Player* const players[2]);
+
+    /**
+     * @brief Run the default scenarios, log each result and write the JSON
+     * @return false if the JSON file could not be written
+     */
+    static bool runAll(int ticks, const std::string& path);
+
+    /**
+     * @brief Write results as a JSON document
+     * @return false if the file could not be written
+     */
+    static bool writeJson(const std::string& path, const std::vector<Result>& results);
+};
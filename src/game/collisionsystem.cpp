@@ -5,13 +5,31 @@
 #include "../entities/player.h"
 #include "../entities/pickup.h"
 #include "platform.h"
-#include <unordered_map>
+#include "../core/alloccounter.h"
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
-ContactList CollisionSystem::detectAndResolve(Context& ctx)
+/**
+ * @brief Bounding box of a circle, used as broadphase query area
+ */
+static inline CollisionBox circleBounds(int cx, int cy, int radius)
 {
-    ContactList contacts;
-    contacts.reserve(32);  // Pre-allocate for typical frame
+    return { cx - radius, cy - radius, radius * 2, radius * 2 };
+}
+
+const ContactList& CollisionSystem::detectAndResolve(Context& ctx)
+{
+    Uint64 allocBefore = AllocCounter::count();
+
+    contacts.clear();
+
+    // Per-entity contact ranges, indexed like the pools' dense arrays
+    ballFloorRanges.assign(ctx.balls.size(), { 0, 0 });
+    hexaFloorRanges.assign(ctx.hexas.size(), { 0, 0 });
+
+    // Phase 0: Broadphase (rebuilt once per tick)
+    buildBroadphase(ctx);
 
     // Phase 1: Detection (const - only builds contacts)
     detectBallVsFloor(ctx, contacts);
@@ -32,13 +50,98 @@ ContactList CollisionSystem::detectAndResolve(Context& ctx)
     resolveBallFloorPhysics(ctx, contacts);
     resolveHexaFloorPhysics(ctx, contacts);
 
+    Uint64 allocations = AllocCounter::count() - allocBefore;
+    allocStats.calls++;
+    allocStats.allocations += allocations;
+    allocStats.lastAllocations = allocations;
+    if (allocations)
+        allocStats.allocatingCalls++;
+
     return contacts;
 }
 
+void CollisionSystem::buildBroadphase(const Context& ctx)
+{
+    // Floors and shots are indexed by their position in the context lists,
+    // so candidate lists sorted by index preserve the original scan order.
+    floorRefs.clear();
+    floorGrid.begin();
+    for (const auto& fl : ctx.floors)
+    {
+        floorGrid.add((int)floorRefs.size(), fl->getCollisionBox());
+        floorRefs.push_back(fl.get());
+    }
+    floorGrid.build();
+
+    shotRefs.clear();
+    shotHandles.clear();
+    shotGrid.begin();
+    for (size_t si = 0; si < ctx.shots.size(); si++)
+    {
+        Shot* sh = ctx.shots[si];
+        shotGrid.add((int)shotRefs.size(), sh->getCollisionBox());
+        shotRefs.push_back(sh);
+        shotHandles.push_back(ctx.shots.handleAt(si));
+    }
+    shotGrid.build();
+
+    // Every ball is packed (dead and flashing ones too) so batch indices
+    // match ctx.balls; those balls are skipped when hits are emitted.
+    ballCircles.clear();
+    ballCircles.reserve(ctx.balls.size());
+    ballGrid.begin();
+    for (size_t bi = 0; bi < ctx.balls.size(); bi++)
+    {
+        int cx, cy;
+        ctx.balls[bi]->getCollisionCenter(cx, cy);
+        int radius = ctx.balls[bi]->getCollisionRadius();
+        ballCircles.add(cx, cy, radius);
+        ballGrid.add((int)bi, circleBounds(cx, cy, radius));
+    }
+    ballGrid.build();
+}
+
+void CollisionSystem::collectCandidates(const BroadphaseGrid& grid, int count, const CollisionBox& area) const
+{
+    if (broadphaseEnabled)
+    {
+        grid.query(area, candidates);
+        return;
+    }
+
+    // Brute force: every item is a candidate (reference path for benchmarks)
+    candidates.resize(count);
+    for (int i = 0; i < count; i++)
+        candidates[i] = i;
+}
+
 void CollisionSystem::detectBallVsShot(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& b : ctx.balls)
+    if (ctx.balls.empty() || shotRefs.empty()) return;
+
+    // Box-major: each shot against all balls. Shots are visited in list
+    // order, so the first shot recorded for a ball is the one the per-ball
+    // scan would have stopped at.
+    firstShotHit.assign(ctx.balls.size(), -1);
+    for (int si = 0; si < (int)shotRefs.size(); si++)
     {
+        Shot* sh = shotRefs[si];
+        if (sh->isDead()) continue;
+        if (sh->getPlayer()->isDead()) continue;
+
+        if (!ballCircles.intersectBox(sh->getCollisionBox(), hitMask)) continue;
+
+        CircleBatch::forEachHit(hitMask, [&](size_t bi) {
+            if (firstShotHit[bi] < 0) firstShotHit[bi] = si;
+        });
+    }
+
+    for (size_t bi = 0; bi < ctx.balls.size(); bi++)
+    {
+        int si = firstShotHit[bi];
+        if (si < 0) continue;
+
+        Ball* b = ctx.balls[bi];
         // Skip dead OR flashing balls (flash = already hit, waiting for death)
         if (b->isDead() || b->isInFlashState()) continue;
 
@@ -47,37 +150,76 @@ void CollisionSystem::detectBallVsShot(const Context& ctx, ContactList& contacts
         b->getCollisionCenter(ballCx, ballCy);
         int ballRadius = b->getCollisionRadius();
 
-        for (const auto& sh : ctx.shots)
+        Shot* sh = shotRefs[si];
+        CollisionBox shotBox = sh->getCollisionBox();
+
+        // Store the AABB in contact for compatibility with existing code
+        contacts.push_back({
+            ContactType::BallShot,
+            b,
+            sh,
+            b->getCollisionBox(),
+            shotBox,
+            getCircleBoxCollisionSide(ballCx, ballCy, ballRadius, shotBox),
+            ctx.balls.handleAt(bi),
+            shotHandles[si]
+        });
+        // Ball can only be hit once per frame (first shot only)
+    }
+}
+
+void CollisionSystem::detectBallVsFloor(const Context& ctx, ContactList& contacts) const
+{
+    if (ctx.balls.empty()) return;
+
+    // Box-major: each floor against the balls near it
+    floorHits.clear();
+    for (int fi = 0; fi < (int)floorRefs.size(); fi++)
+    {
+        Platform* fl = floorRefs[fi];
+        if (fl->isInvisible()) continue;
+
+        CollisionBox floorBox = fl->getCollisionBox();
+
+        if (broadphaseEnabled)
         {
-            if (sh->isDead()) continue;
-            if (sh->getPlayer()->isDead()) continue;
+            ballGrid.query(floorBox, candidates);
+            if (candidates.empty()) continue;
 
-            CollisionBox shotBox = sh->getCollisionBox();
+            candidateCircles.gather(ballCircles, candidates);
+            if (!candidateCircles.intersectBox(floorBox, hitMask)) continue;
 
-            // Use circle-box collision for ball vs shot
-            if (circleIntersectsBox(ballCx, ballCy, ballRadius, shotBox))
-            {
-                // Store the AABB in contact for compatibility with existing code
-                CollisionBox ballBox = b->getCollisionBox();
-                contacts.push_back({
-                    ContactType::BallShot,
-                    b.get(),
-                    sh.get(),
-                    ballBox,
-                    shotBox,
-                    getCircleBoxCollisionSide(ballCx, ballCy, ballRadius, shotBox)
-                });
+            CircleBatch::forEachHit(hitMask, [&](size_t j) {
+                floorHits.push_back({ candidates[j], fi });
+            });
+        }
+        else
+        {
+            // Brute force: test every ball (reference path for benchmarks)
+            if (!ballCircles.intersectBox(floorBox, hitMask)) continue;
 
-                break;  // Ball can only be hit once per frame
-            }
+            CircleBatch::forEachHit(hitMask, [&](size_t bi) {
+                floorHits.push_back({ (int)bi, fi });
+            });
         }
     }
-}
 
-void CollisionSystem::detectBallVsFloor(const Context& ctx, ContactList& contacts) const
-{
-    for (const auto& b : ctx.balls)
+    // Back to ball-major order, floors in list order within a ball
+    // (pairs are unique, so std::sort is enough and does not allocate)
+    std::sort(floorHits.begin(), floorHits.end(),
+        [](const BallFloorHit& a, const BallFloorHit& b) {
+            return a.ball != b.ball ? a.ball < b.ball : a.floor < b.floor;
+        });
+
+    size_t next = 0;
+    for (int bi = 0; bi < (int)ctx.balls.size(); bi++)
     {
+        // This ball's overlaps: floorHits[first, next)
+        size_t first = next;
+        while (next < floorHits.size() && floorHits[next].ball == bi)
+            next++;
+
+        Ball* b = ctx.balls[bi];
         // Skip dead OR flashing balls
         if (b->isDead() || b->isInFlashState()) continue;
 
@@ -85,21 +227,52 @@ void CollisionSystem::detectBallVsFloor(const Context& ctx, ContactList& contact
         int ballCx, ballCy;
         b->getCollisionCenter(ballCx, ballCy);
         int ballRadius = b->getCollisionRadius();
-        CollisionBox ballBox = b->getCollisionBox();  // For Contact struct compatibility
+
+        if (first == next)
+        {
+            // No overlap at the end of the step: a fast ball may have
+            // passed through a platform during it
+            if (!sweepEnabled || !b->hasStepStart()) continue;
+
+            float half = (float)(b->getDiameter() / 2);
+            int fi;
+            float toi;
+            CollisionSide side;
+            if (!sweepFloors(b->getStepStartX() + half, b->getStepStartY() + half, b->getX() + half, b->getY() + half,
+                             ballRadius, fi, toi, side))
+                continue;
+
+            ContactRange& range = ballFloorRanges[bi];
+            range.first = (Uint32)contacts.size();
+            range.count = 1;
+
+            // Ball box at the impact point
+            Platform* fl = floorRefs[fi];
+            CollisionBox ballBox = b->getCollisionBox();
+            ballBox.x = (int)(b->getStepStartX() + (b->getX() - b->getStepStartX()) * toi);
+            ballBox.y = (int)(b->getStepStartY() + (b->getY() - b->getStepStartY()) * toi);
+
+            contacts.push_back({
+                ContactType::BallFloor,
+                b,
+                fl,
+                ballBox,
+                fl->getCollisionBox(),
+                side,
+                ctx.balls.handleAt(bi)
+            });
+            contacts.back().toi = toi;
+            continue;
+        }
 
         float dirX = b->getDirX();
         int dirY = b->getDirY();
 
-        for (const auto& fl : ctx.floors)
+        for (size_t h = first; h < next; h++)
         {
-            if (fl->isInvisible()) continue;
-
+            Platform* fl = floorRefs[floorHits[h].floor];
             CollisionBox floorBox = fl->getCollisionBox();
 
-            // Use circle-box collision for ball vs floor
-            if (!circleIntersectsBox(ballCx, ballCy, ballRadius, floorBox))
-                continue;
-
             CollisionSide side = getCircleBoxCollisionSide(ballCx, ballCy, ballRadius, floorBox);
 
             // Check if ball center is inside floor (emergency escape)
@@ -122,82 +295,151 @@ void CollisionSystem::detectBallVsFloor(const Context& ctx, ContactList& contact
                 if (validX) recordedSide.x = side.x;
                 if (validY) recordedSide.y = side.y;
 
+                // A ball's floor contacts are consecutive (hits are sorted by ball)
+                ContactRange& range = ballFloorRanges[bi];
+                if (range.count == 0)
+                    range.first = (Uint32)contacts.size();
+                range.count++;
+
                 contacts.push_back({
                     ContactType::BallFloor,
-                    b.get(),
-                    fl.get(),
-                    ballBox,
+                    b,
+                    fl,
+                    b->getCollisionBox(),  // For Contact struct compatibility
                     floorBox,
-                    recordedSide
+                    recordedSide,
+                    ctx.balls.handleAt(bi)
                 });
             }
         }
     }
 }
 
+bool CollisionSystem::sweepFloors(float x0, float y0, float x1, float y1, int radius,
+                                  int& outFloor, float& outToi, CollisionSide& outSide) const
+{
+    // Moving at most one radius per step, a circle cannot skip a platform
+    if (std::fabs(x1 - x0) <= (float)radius && std::fabs(y1 - y0) <= (float)radius)
+        return false;
+
+    // Query the area covered by the whole step
+    int qx0 = (int)std::floor(std::min(x0, x1)) - radius;
+    int qy0 = (int)std::floor(std::min(y0, y1)) - radius;
+    int qx1 = (int)std::ceil(std::max(x0, x1)) + radius;
+    int qy1 = (int)std::ceil(std::max(y0, y1)) + radius;
+
+    outFloor = -1;
+    collectCandidates(floorGrid, (int)floorRefs.size(), { qx0, qy0, qx1 - qx0, qy1 - qy0 });
+    for (int idx : candidates)
+    {
+        Platform* fl = floorRefs[idx];
+        if (fl->isInvisible()) continue;
+
+        float toi;
+        CollisionSide side;
+        if (!sweepCircleBox(x0, y0, x1, y1, (float)radius, fl->getCollisionBox(), toi, side))
+            continue;
+
+        // Earliest impact wins (candidates are in list order, so ties keep the first)
+        if (outFloor < 0 || toi < outToi)
+        {
+            outFloor = idx;
+            outToi = toi;
+            outSide = side;
+        }
+    }
+
+    return outFloor >= 0;
+}
+
 void CollisionSystem::detectBallVsPlayer(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& b : ctx.balls)
+    if (ctx.balls.empty()) return;
+
+    // Box-major: each player against all balls
+    bool anyHit = false;
+    for (int i = 0; i < 2; i++)
     {
-        // Skip dead OR flashing balls (flash = already hit, waiting for death)
-        if (b->isDead() || b->isInFlashState()) continue;
+        playerHitMask[i].clear();
+        if (!ctx.players[i]) continue;
+        if (ctx.players[i]->isImmune()) continue;
+        if (ctx.players[i]->isDead()) continue;
 
-        // Get ball circle collision data
-        int ballCx, ballCy;
-        b->getCollisionCenter(ballCx, ballCy);
-        int ballRadius = b->getCollisionRadius();
+        if (ballCircles.intersectBox(ctx.players[i]->getCollisionBox(), playerHitMask[i]))
+            anyHit = true;
+    }
+    if (!anyHit) return;
+
+    for (size_t bi = 0; bi < ctx.balls.size(); bi++)
+    {
+        Ball* b = ctx.balls[bi];
 
         for (int i = 0; i < 2; i++)
         {
-            if (!ctx.players[i]) continue;
-            if (ctx.players[i]->isImmune()) continue;
-            if (ctx.players[i]->isDead()) continue;
+            const std::vector<Uint32>& mask = playerHitMask[i];
+            if (mask.empty() || !(mask[bi / 32] & (1u << (bi % 32)))) continue;
+
+            // Skip dead OR flashing balls (flash = already hit, waiting for death)
+            if (b->isDead() || b->isInFlashState()) break;
+
+            // Get ball circle collision data
+            int ballCx, ballCy;
+            b->getCollisionCenter(ballCx, ballCy);
+            int ballRadius = b->getCollisionRadius();
 
             CollisionBox playerBox = ctx.players[i]->getCollisionBox();
 
-            // Use circle-box collision for ball vs player
-            if (circleIntersectsBox(ballCx, ballCy, ballRadius, playerBox))
-            {
-                // Store the AABB in contact for compatibility with existing code
-                CollisionBox ballBox = b->getCollisionBox();
-                contacts.push_back({
-                    ContactType::BallPlayer,
-                    b.get(),
-                    ctx.players[i],
-                    ballBox,
-                    playerBox,
-                    getCircleBoxCollisionSide(ballCx, ballCy, ballRadius, playerBox)
-                });
-            }
+            // Store the AABB in contact for compatibility with existing code
+            contacts.push_back({
+                ContactType::BallPlayer,
+                b,
+                ctx.players[i],
+                b->getCollisionBox(),
+                playerBox,
+                getCircleBoxCollisionSide(ballCx, ballCy, ballRadius, playerBox),
+                ctx.balls.handleAt(bi)
+            });
         }
     }
 }
 
 void CollisionSystem::detectShotVsFloor(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& sh : ctx.shots)
+    for (size_t si = 0; si < ctx.shots.size(); si++)
     {
+        Shot* sh = ctx.shots[si];
         if (sh->isDead()) continue;
 
-        for (const auto& fl : ctx.floors)
+        // Query with the union of both shot boxes (which one applies depends on the floor)
+        CollisionBox fullBox = sh->getCollisionBox();
+        CollisionBox tipBox = sh->getFloorCollisionBox();
+        int qx0 = std::min(fullBox.x, tipBox.x);
+        int qy0 = std::min(fullBox.y, tipBox.y);
+        int qx1 = std::max(fullBox.x + fullBox.w, tipBox.x + tipBox.w);
+        int qy1 = std::max(fullBox.y + fullBox.h, tipBox.y + tipBox.h);
+
+        collectCandidates(floorGrid, (int)floorRefs.size(), { qx0, qy0, qx1 - qx0, qy1 - qy0 });
+        for (int idx : candidates)
         {
+            Platform* fl = floorRefs[idx];
             CollisionBox floorBox = fl->getCollisionBox();
 
             // Destructible platforms (Glass) use full shot collision box (like balls)
             // Regular floors use reduced collision box (tip to gun position)
             CollisionBox shotBox = fl->isDestructible()
-                ? sh->getCollisionBox()
-                : sh->getFloorCollisionBox();
+                ? fullBox
+                : tipBox;
 
             if (intersects(shotBox, floorBox))
             {
                 contacts.push_back({
                     ContactType::ShotFloor,
-                    sh.get(),
-                    fl.get(),
+                    sh,
+                    fl,
                     shotBox,
                     floorBox,
-                    getCollisionSide(shotBox, floorBox)
+                    getCollisionSide(shotBox, floorBox),
+                    ctx.shots.handleAt(si)
                 });
 
                 break;  // Shot can only hit one floor per frame
@@ -208,39 +450,36 @@ void CollisionSystem::detectShotVsFloor(const Context& ctx, ContactList& contact
 
 void CollisionSystem::resolveBallFloorPhysics(const Context& ctx, ContactList& contacts)
 {
-    // Group BallFloor contacts by ball pointer
-    std::unordered_map<Ball*, std::vector<Contact*>> ballContacts;
-
-    for (auto& c : contacts)
+    // Resolve physics for each ball with floor contacts
+    for (size_t bi = 0; bi < ballFloorRanges.size(); bi++)
     {
-        if (c.type == ContactType::BallFloor)
-        {
-            ballContacts[c.getBall()].push_back(&c);
-        }
-    }
+        const ContactRange& range = ballFloorRanges[bi];
+        if (range.count == 0) continue;
 
-    // Resolve physics for each ball
-    for (auto& pair : ballContacts)
-    {
-        Ball* ball = pair.first;
-        std::vector<Contact*>& floorHits = pair.second;
+        Ball* ball = ctx.balls[bi];
+        const Contact* floorHits = &contacts[range.first];
 
-        if (floorHits.size() == 1)
+        if (floorHits[0].toi < 1.0f)
+        {
+            // Swept hit (always alone): bounce at the impact point
+            ball->bounceAtImpact(floorHits[0].toi, floorHits[0].side, ctx.stepDt);
+        }
+        else if (range.count == 1)
         {
             // Single floor hit - simple bounce based on collision side
-            const CollisionSide& side = floorHits[0]->side;
+            const CollisionSide& side = floorHits[0].side;
             if (side.hasHorizontal()) ball->setDirX(-ball->getDirX());
             if (side.hasVertical()) ball->setDirY(-ball->getDirY());
         }
         else
         {
             // Multiple floors hit - analyze alignment to determine bounce
-            resolveMultiFloorCollision(ball, floorHits);
+            resolveMultiFloorCollision(ball, floorHits, range.count);
         }
     }
 }
 
-void CollisionSystem::resolveMultiFloorCollision(Ball* ball, std::vector<Contact*>& floorHits)
+void CollisionSystem::resolveMultiFloorCollision(Ball* ball, const Contact* floorHits, size_t count)
 {
     // Merge collision sides from all floor contacts
     // Key insight: aligned floors form a single logical surface
@@ -269,23 +508,23 @@ void CollisionSystem::resolveMultiFloorCollision(Ball* ball, std::vector<Contact
     // Check if all floors are aligned (share same Y or same X)
     bool allSameY = true;
     bool allSameX = true;
-    int firstY = floorHits[0]->boxB.y;
-    int firstX = floorHits[0]->boxB.x;
+    int firstY = floorHits[0].boxB.y;
+    int firstX = floorHits[0].boxB.x;
 
-    for (size_t i = 1; i < floorHits.size(); i++)
+    for (size_t i = 1; i < count; i++)
     {
-        if (floorHits[i]->boxB.y != firstY) allSameY = false;
-        if (floorHits[i]->boxB.x != firstX) allSameX = false;
+        if (floorHits[i].boxB.y != firstY) allSameY = false;
+        if (floorHits[i].boxB.x != firstX) allSameX = false;
     }
 
     // Collect all collision sides
     bool hasHorizontalHit = false;
     bool hasVerticalHit = false;
 
-    for (const auto* contact : floorHits)
+    for (size_t i = 0; i < count; i++)
     {
-        if (contact->side.hasHorizontal()) hasHorizontalHit = true;
-        if (contact->side.hasVertical()) hasVerticalHit = true;
+        if (floorHits[i].side.hasHorizontal()) hasHorizontalHit = true;
+        if (floorHits[i].side.hasVertical()) hasVerticalHit = true;
     }
 
     if (allSameY && hasVerticalHit)
@@ -315,8 +554,9 @@ void CollisionSystem::resolveMultiFloorCollision(Ball* ball, std::vector<Contact
 
 void CollisionSystem::detectPickupVsPlayer(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& pickup : ctx.pickups)
+    for (size_t pi = 0; pi < ctx.pickups.size(); pi++)
     {
+        Pickup* pickup = ctx.pickups[pi];
         if (pickup->isDead()) continue;
 
         for (int i = 0; i < 2; i++)
@@ -331,11 +571,12 @@ void CollisionSystem::detectPickupVsPlayer(const Context& ctx, ContactList& cont
             {
                 contacts.push_back({
                     ContactType::PickupPlayer,
-                    pickup.get(),
+                    pickup,
                     ctx.players[i],
                     pickupBox,
                     playerBox,
-                    {}  // No collision side needed for pickup
+                    {},  // No collision side needed for pickup
+                    ctx.pickups.handleAt(pi)
                 });
 
                 break;  // Pickup can only be collected by one player
@@ -346,8 +587,9 @@ void CollisionSystem::detectPickupVsPlayer(const Context& ctx, ContactList& cont
 
 void CollisionSystem::detectHexaVsShot(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& h : ctx.hexas)
+    for (size_t hi = 0; hi < ctx.hexas.size(); hi++)
     {
+        Hexa* h = ctx.hexas[hi];
         // Skip dead OR flashing hexas (flash = already hit, waiting for death)
         if (h->isDead() || h->isInFlashState()) continue;
 
@@ -355,8 +597,10 @@ void CollisionSystem::detectHexaVsShot(const Context& ctx, ContactList& contacts
         h->getCollisionCenter(hexaCx, hexaCy);
         int hexaRadius = h->getCollisionRadius();
 
-        for (const auto& sh : ctx.shots)
+        collectCandidates(shotGrid, (int)shotRefs.size(), circleBounds(hexaCx, hexaCy, hexaRadius));
+        for (int idx : candidates)
         {
+            Shot* sh = shotRefs[idx];
             if (sh->isDead()) continue;
             if (sh->getPlayer()->isDead()) continue;
 
@@ -366,11 +610,13 @@ void CollisionSystem::detectHexaVsShot(const Context& ctx, ContactList& contacts
             {
                 contacts.push_back({
                     ContactType::HexaShot,
-                    h.get(),
-                    sh.get(),
+                    h,
+                    sh,
                     h->getCollisionBox(),
                     shotBox,
-                    getCircleBoxCollisionSide(hexaCx, hexaCy, hexaRadius, shotBox)
+                    getCircleBoxCollisionSide(hexaCx, hexaCy, hexaRadius, shotBox),
+                    ctx.hexas.handleAt(hi),
+                    shotHandles[idx]
                 });
 
                 break;  // Hexa can only be hit once per frame
@@ -381,8 +627,9 @@ void CollisionSystem::detectHexaVsShot(const Context& ctx, ContactList& contacts
 
 void CollisionSystem::detectHexaVsFloor(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& h : ctx.hexas)
+    for (size_t hi = 0; hi < ctx.hexas.size(); hi++)
     {
+        Hexa* h = ctx.hexas[hi];
         // Skip dead OR flashing hexas
         if (h->isDead() || h->isInFlashState()) continue;
 
@@ -392,8 +639,11 @@ void CollisionSystem::detectHexaVsFloor(const Context& ctx, ContactList& contact
         float velX = h->getVelX();
         float velY = h->getVelY();
 
-        for (const auto& fl : ctx.floors)
+        bool overlapped = false;
+        collectCandidates(floorGrid, (int)floorRefs.size(), circleBounds(hexaCx, hexaCy, hexaRadius));
+        for (int idx : candidates)
         {
+            Platform* fl = floorRefs[idx];
             if (fl->isInvisible()) continue;
 
             CollisionBox floorBox = fl->getCollisionBox();
@@ -401,6 +651,8 @@ void CollisionSystem::detectHexaVsFloor(const Context& ctx, ContactList& contact
             if (!circleIntersectsBox(hexaCx, hexaCy, hexaRadius, floorBox))
                 continue;
 
+            overlapped = true;
+
             CollisionSide side = getCircleBoxCollisionSide(hexaCx, hexaCy, hexaRadius, floorBox);
 
             // Check if hexa center is inside floor (emergency escape)
@@ -422,23 +674,65 @@ void CollisionSystem::detectHexaVsFloor(const Context& ctx, ContactList& contact
                 if (validX) recordedSide.x = side.x;
                 if (validY) recordedSide.y = side.y;
 
+                // A hexa's floor contacts are consecutive (one hexa at a time)
+                ContactRange& range = hexaFloorRanges[hi];
+                if (range.count == 0)
+                    range.first = (Uint32)contacts.size();
+                range.count++;
+
                 contacts.push_back({
                     ContactType::HexaFloor,
-                    h.get(),
-                    fl.get(),
+                    h,
+                    fl,
                     h->getCollisionBox(),
                     floorBox,
-                    recordedSide
+                    recordedSide,
+                    ctx.hexas.handleAt(hi)
                 });
             }
         }
+
+        // No overlap at the end of the step: a fast hexa may have passed
+        // through a platform during it
+        if (overlapped || !sweepEnabled || !h->hasStepStart()) continue;
+
+        float halfW = (float)(h->getWidth() / 2);
+        float halfH = (float)(h->getHeight() / 2);
+        int fi;
+        float toi;
+        CollisionSide side;
+        if (!sweepFloors(h->getStepStartX() + halfW, h->getStepStartY() + halfH, h->getX() + halfW, h->getY() + halfH,
+                         hexaRadius, fi, toi, side))
+            continue;
+
+        ContactRange& range = hexaFloorRanges[hi];
+        range.first = (Uint32)contacts.size();
+        range.count = 1;
+
+        // Hexa box at the impact point
+        Platform* fl = floorRefs[fi];
+        CollisionBox hexaBox = h->getCollisionBox();
+        hexaBox.x = (int)(h->getStepStartX() + (h->getX() - h->getStepStartX()) * toi);
+        hexaBox.y = (int)(h->getStepStartY() + (h->getY() - h->getStepStartY()) * toi);
+
+        contacts.push_back({
+            ContactType::HexaFloor,
+            h,
+            fl,
+            hexaBox,
+            fl->getCollisionBox(),
+            side,
+            ctx.hexas.handleAt(hi)
+        });
+        contacts.back().toi = toi;
     }
 }
 
 void CollisionSystem::detectHexaVsPlayer(const Context& ctx, ContactList& contacts) const
 {
-    for (const auto& h : ctx.hexas)
+    for (size_t hi = 0; hi < ctx.hexas.size(); hi++)
     {
+        Hexa* h = ctx.hexas[hi];
         // Skip dead OR flashing hexas (flash = already hit, waiting for death)
         if (h->isDead() || h->isInFlashState()) continue;
 
@@ -458,11 +752,12 @@ void CollisionSystem::detectHexaVsPlayer(const Context& ctx, ContactList& contac
             {
                 contacts.push_back({
                     ContactType::HexaPlayer,
-                    h.get(),
+                    h,
                     ctx.players[i],
                     h->getCollisionBox(),
                     playerBox,
-                    getCircleBoxCollisionSide(hexaCx, hexaCy, hexaRadius, playerBox)
+                    getCircleBoxCollisionSide(hexaCx, hexaCy, hexaRadius, playerBox),
+                    ctx.hexas.handleAt(hi)
                 });
             }
         }
@@ -471,29 +766,28 @@ void CollisionSystem::detectHexaVsPlayer(const Context& ctx, ContactList& contac
 
 void CollisionSystem::resolveHexaFloorPhysics(const Context& ctx, ContactList& contacts)
 {
-    // Group HexaFloor contacts by hexa pointer
-    std::unordered_map<Hexa*, std::vector<Contact*>> hexaContacts;
-
-    for (auto& c : contacts)
+    // Resolve physics for each hexa with floor contacts
+    for (size_t hi = 0; hi < hexaFloorRanges.size(); hi++)
     {
-        if (c.type == ContactType::HexaFloor)
+        const ContactRange& range = hexaFloorRanges[hi];
+        if (range.count == 0) continue;
+
+        Hexa* hexa = ctx.hexas[hi];
+        const Contact& firstHit = contacts[range.first];
+        if (firstHit.toi < 1.0f)
         {
-            hexaContacts[c.getHexa()].push_back(&c);
+            // Swept hit (always alone): bounce at the impact point
+            hexa->bounceAtImpact(firstHit.toi, firstHit.side, ctx.stepDt);
+            continue;
         }
-    }
-
-    // Resolve physics for each hexa
-    for (auto& pair : hexaContacts)
-    {
-        Hexa* hexa = pair.first;
-        std::vector<Contact*>& floorHits = pair.second;
 
         // Merge collision sides from all floor contacts
         CollisionSide mergedSide;
-        for (const auto* contact : floorHits)
+        for (Uint32 i = range.first; i < range.first + range.count; i++)
         {
-            if (contact->side.hasHorizontal()) mergedSide.x = contact->side.x;
-            if (contact->side.hasVertical()) mergedSide.y = contact->side.y;
+            const Contact& contact = contacts[i];
+            if (contact.side.hasHorizontal()) mergedSide.x = contact.side.x;
+            if (contact.side.hasVertical()) mergedSide.y = contact.side.y;
         }
 
         // Apply bounce via hexa's handlePlatformBounce
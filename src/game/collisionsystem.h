@@ -7,6 +7,9 @@
 #include <algorithm>
 #include "../core/collisionbox.h"
 #include "contact.h"
+#include "broadphasegrid.h"
+#include "circlebatch.h"
+#include "entitypools.h"
 
 // Forward declarations
 class Ball;
@@ -100,6 +103,20 @@ inline bool intersects(const CollisionBox& a, const CollisionBox& b, SDL_Point&
  * - Resolving physics (bouncing balls off walls)
  * - Reporting what touched what (via ContactList)
  *
+ * Contacts carry the pool handles of the pooled entities involved, so
+ * CollisionRules can tell whether an entity is still alive.
+ *
+ * Floors and shots are bucketed into a BroadphaseGrid once per tick, and
+ * every detect pass only tests the candidates sharing a grid cell. Candidates
+ * are visited in original list order, so the ContactList is identical to a
+ * brute-force scan.
+ *
+ * Ball tests are box-major: the ball circles are packed into a CircleBatch
+ * once per tick, and each floor, shot and player box is tested against the
+ * whole batch (or, for floors, the balls sharing its grid cells) with SIMD.
+ * Collision sides are only computed for the hits, and contacts are emitted
+ * ball by ball in the same order as the per-ball scan.
+ *
  * It does NOT handle:
  * - Scoring
  * - Killing entities
@@ -117,13 +134,14 @@ public:
      */
     struct Context
     {
-        std::list<std::unique_ptr<Ball>>& balls;    ///< Active balls
-        std::list<std::unique_ptr<Hexa>>& hexas;    ///< Active hexas
-        std::list<std::unique_ptr<Shot>>& shots;    ///< Active shots
+        BallPool& balls;                            ///< Active balls
+        HexaPool& hexas;                            ///< Active hexas
+        ShotPool& shots;                            ///< Active shots
         std::list<std::unique_ptr<Platform>>& floors;  ///< Active platforms (Floor + Glass)
-        std::list<std::unique_ptr<Pickup>>& pickups; ///< Active pickups
+        PickupPool& pickups;                        ///< Active pickups
         Player* players[2];                         ///< Players (may be nullptr)
         bool checkPlayerCollisions;                 ///< Whether to check ball/hexa-player collisions
+        float stepDt = 0.0f;                        ///< Length of the step just simulated (swept bounces finish it)
     };
 
     CollisionSystem() = default;
@@ -135,12 +153,129 @@ public:
      * 1. Detection: builds ContactList (const operations)
      * 2. Resolution: applies physics (ball bounces)
      *
+     * The contact list and all scratch buffers are owned by the system and
+     * reused every tick, so once they have grown to the working size a call
+     * makes no heap allocations (see getAllocStats()).
+     *
      * @param ctx Collision context with entity lists and flags
-     * @return List of contacts detected this frame
+     * @return List of contacts detected this frame (valid until the next call)
      */
-    ContactList detectAndResolve(Context& ctx);
+    const ContactList& detectAndResolve(Context& ctx);
+
+    /**
+     * @struct AllocStats
+     * @brief Heap allocations made inside detectAndResolve (Debug builds, see AllocCounter)
+     */
+    struct AllocStats
+    {
+        Uint64 calls = 0;               ///< detectAndResolve calls since reset
+        Uint64 allocatingCalls = 0;     ///< Calls that allocated at least once
+        Uint64 allocations = 0;         ///< Total allocations since reset
+        Uint64 lastAllocations = 0;     ///< Allocations made by the last call
+    };
+
+    const AllocStats& getAllocStats() const { return allocStats; }
+    void resetAllocStats() { allocStats = AllocStats(); }
+
+    /**
+     * @brief Enable or disable broadphase culling
+     *
+     * When disabled, every floor/shot is a candidate (brute-force scan).
+     * Contacts are the same either way; useful for benchmarking.
+     */
+    void setBroadphaseEnabled(bool enabled) { broadphaseEnabled = enabled; }
+    bool isBroadphaseEnabled() const { return broadphaseEnabled; }
+
+    /**
+     * @brief Enable or disable swept (continuous) ball/hexa vs platform tests
+     *
+     * When enabled, a ball or hexa that moved farther than its radius during
+     * the step and does not overlap any platform at the end of it is swept
+     * along its path (from IGameObject::getStepStartX/Y). If it touched a platform
+     * on the way, a contact with the time of impact (Contact::toi) is
+     * recorded, and resolution moves it back to the impact point, bounces it
+     * and finishes the step (Context::stepDt). This stops fast movers from
+     * passing through thin platforms at coarse timesteps.
+     *
+     * At the normal 60 Hz step nothing moves farther than its radius, so
+     * regular play is unaffected.
+     */
+    void setSweepEnabled(bool enabled) { sweepEnabled = enabled; }
+    bool isSweepEnabled() const { return sweepEnabled; }
 
 private:
+    // ========== Broadphase ==========
+
+    BroadphaseGrid floorGrid;               ///< Platforms bucketed by cell (indices into floorRefs)
+    BroadphaseGrid shotGrid;                ///< Shots bucketed by cell (indices into shotRefs)
+    std::vector<Platform*> floorRefs;       ///< Platforms in context list order
+    std::vector<Shot*> shotRefs;            ///< Shots in context list order
+    std::vector<EntityHandle> shotHandles;  ///< Pool handle of each entry in shotRefs
+    BroadphaseGrid ballGrid;                ///< Balls bucketed by circle bounds (indices into ctx.balls)
+    CircleBatch ballCircles;                ///< Collision circle of every ball, in ctx.balls order
+    mutable std::vector<int> candidates;    ///< Scratch buffer for grid queries
+
+    // ========== Ball batch scratch ==========
+
+    /// A ball-floor overlap found by the box-major floor pass
+    struct BallFloorHit
+    {
+        int ball;    ///< Index in ctx.balls
+        int floor;   ///< Index in floorRefs
+    };
+
+    mutable CircleBatch candidateCircles;       ///< Circles of the grid candidates of one floor
+    mutable std::vector<Uint32> hitMask;        ///< CircleBatch result for the current box
+    mutable std::vector<Uint32> playerHitMask[2];
+    mutable std::vector<int> firstShotHit;      ///< Per ball: first shot (shotRefs index) hitting it, -1 if none
+    mutable std::vector<BallFloorHit> floorHits;
+    bool broadphaseEnabled = true;
+    bool sweepEnabled = true;
+
+    // ========== Per-frame buffers (reused, never shrunk) ==========
+
+    /// Run of consecutive contacts in the contact list
+    struct ContactRange
+    {
+        Uint32 first;
+        Uint32 count;
+    };
+
+    ContactList contacts;                               ///< Returned by detectAndResolve
+    mutable std::vector<ContactRange> ballFloorRanges;  ///< Per ctx.balls index: its BallFloor contacts
+    mutable std::vector<ContactRange> hexaFloorRanges;  ///< Per ctx.hexas index: its HexaFloor contacts
+    AllocStats allocStats;
+
+    /**
+     * @brief Rebuild floor, shot and ball grids and the ball circle batch
+     */
+    void buildBroadphase(const Context& ctx);
+
+    /**
+     * @brief Fill the candidates buffer with item indices near an area
+     * @param grid Grid to query
+     * @param count Number of items in the grid (used for brute-force fallback)
+     * @param area Query box
+     */
+    void collectCandidates(const BroadphaseGrid& grid, int count, const CollisionBox& area) const;
+
+    /**
+     * @brief Sweep a moving circle against the platforms
+     *
+     * Only runs when the circle moved farther than its radius; otherwise
+     * the discrete tests cannot miss a platform.
+     *
+     * @param x0,y0 Circle center at the start of the step
+     * @param x1,y1 Circle center at the end of the step
+     * @param radius Circle radius
+     * @param outFloor Receives the index in floorRefs of the first platform touched
+     * @param outToi Receives the time of impact [0,1]
+     * @param outSide Receives the side(s) of the platform that were hit
+     * @return true if a platform was touched during the step
+     */
+    bool sweepFloors(float x0, float y0, float x1, float y1, int radius,
+                     int& outFloor, float& outToi, CollisionSide& outSide) const;
+
     // ========== Phase 1: Detection (const - only builds contacts) ==========
 
     /**
@@ -198,7 +333,8 @@ private:
     /**
      * @brief Resolve ball-floor physics based on detected contacts
      *
-     * Groups contacts by ball and determines bounce direction.
+     * Walks the per-ball contact ranges recorded during detection and
+     * determines bounce direction.
      * For multiple floor hits, analyzes floor alignment to handle:
      * - Horizontally aligned floors (same Y) → single horizontal surface
      * - Vertically aligned floors (same X) → single vertical surface
@@ -209,15 +345,16 @@ private:
     /**
      * @brief Handle multi-floor collision by analyzing floor alignment
      * @param ball The ball that hit multiple floors
-     * @param floorHits Vector of contacts with floors
+     * @param floorHits First of the ball's consecutive contacts with floors
+     * @param count Number of floor contacts
      */
-    void resolveMultiFloorCollision(Ball* ball, std::vector<Contact*>& floorHits);
+    void resolveMultiFloorCollision(Ball* ball, const Contact* floorHits, size_t count);
 
     /**
      * @brief Resolve hexa-floor physics based on detected contacts
      *
      * Calls hexa->handlePlatformBounce() for each floor hit.
-     * Groups contacts by hexa and determines bounce direction.
+     * Walks the per-hexa contact ranges and determines bounce direction.
      */
     void resolveHexaFloorPhysics(const Context& ctx, ContactList& contacts);
 };
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include "../core/collisionbox.h"
+#include "../core/entitypool.h"
 
 // Forward declarations - Contact stores only pointers to these types
 class IGameObject;
@@ -56,6 +57,14 @@ struct Contact
     // For BallFloor: which side of the floor the ball hit
     CollisionSide side;
 
+    // Pool handles of A and B (invalid for platforms and players, which are not pooled)
+    EntityHandle handleA;
+    EntityHandle handleB;
+
+    // Swept contacts (BallFloor/HexaFloor only): fraction of the step at which
+    // A touched B. 1 for discrete contacts, found overlapping at the end of the step.
+    float toi = 1.0f;
+
     // Convenience accessors with type safety
     // Note: Using reinterpret_cast because forward declarations prevent static_cast
     Ball* getBall() const { return reinterpret_cast<Ball*>(entityA); }
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include "../core/entitypool.h"
+#include "../core/recyclepool.h"
+#include "ball.h"
+#include "ballkernel.h"
+#include "hexa.h"
+#include "harpoonshot.h"
+#include "gunshot.h"
+#include "clawshot.h"
+#include "pickup.h"
+#include "animeffect.h"
+#include "hitscore.h"
+
+/**
+ * Pool types for the Scene's dynamic entities (see EntityPool).
+ *
+ * Shots are stored polymorphically, so a shot slot is sized for the
+ * largest Shot subclass. Add new Shot subclasses to the lists below.
+ *
+ * Purely visual, short-lived objects (effects, score popups) use
+ * fixed-capacity RecyclePools instead and are reset in place.
+ */
+static constexpr size_t SHOT_SLOT_SIZE = std::max({ sizeof(HarpoonShot), sizeof(GunShot), sizeof(ClawShot) });
+static constexpr size_t SHOT_SLOT_ALIGN = std::max({ alignof(HarpoonShot), alignof(GunShot), alignof(ClawShot) });
+
+/**
+ * BallPool class
+ *
+ * EntityPool of balls whose motion lives in a BallKernel: the i-th ball
+ * owns lane i of getMotion(). emplace() appends a lane for the new ball
+ * and erase() swap-and-pops the lane along with the ball, so the store
+ * stays in the pool's dense order and Scene can step all balls in place.
+ *
+ * Otherwise used like an EntityPool (handles, index loops, range-for).
+ */
+class BallPool
+{
+public:
+    using iterator = EntityPool<Ball>::iterator;
+
+    BallPool() = default;
+    ~BallPool() { clear(); }
+
+    BallPool(const BallPool&) = delete;
+    BallPool& operator=(const BallPool&) = delete;
+
+    /**
+     * @brief Construct a ball in a free slot, with a new motion lane
+     *
+     * Arguments are those of the Ball constructors after the lane.
+     */
+    template<typename... Args>
+    Ball* emplace(Args&&... args)
+    {
+        Uint32 lane = motion.add();
+        return pool.emplace(motion, lane, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroy the ball at a dense index (swap-and-pop, ball and lane)
+     */
+    void erase(size_t i)
+    {
+        pool.erase(i);
+        motion.removeAt(i);
+        if (i < pool.size())
+            pool[i]->lane = (Uint32)i;
+    }
+
+    void clear()
+    {
+        pool.clear();
+        motion.clear();
+    }
+
+    Ball* get(EntityHandle h) const { return pool.get(h); }
+    EntityHandle handleAt(size_t i) const { return pool.handleAt(i); }
+
+    Ball* operator[](size_t i) const { return pool[i]; }
+    Ball* back() const { return pool.back(); }
+
+    size_t size() const { return pool.size(); }
+    bool empty() const { return pool.empty(); }
+    size_t capacity() const { return pool.capacity(); }
+
+    iterator begin() const { return pool.begin(); }
+    iterator end() const { return pool.end(); }
+
+    /// Motion store of the balls (lane i = ball i)
+    BallKernel& getMotion() { return motion; }
+    const BallKernel& getMotion() const { return motion; }
+
+private:
+    BallKernel motion;      // Declared first: outlives the balls
+    EntityPool<Ball> pool;
+};
+
+using HexaPool = EntityPool<Hexa>;
+using ShotPool = EntityPool<Shot, SHOT_SLOT_SIZE, SHOT_SLOT_ALIGN>;
+using PickupPool = EntityPool<Pickup>;
+using EffectPool = RecyclePool<AnimEffect>;
+using HitScorePool = RecyclePool<HitScore>;
@@ -40,8 +40,11 @@ private:
 
 public:
     Floor(Scene* scene, int x, int y, FloorType type, int color = 0);
+    Floor(const Floor&) = default;
     ~Floor();
 
+    std::unique_ptr<Platform> clone() const override { return std::make_unique<Floor>(*this); }
+
     void update(float dt) override;
 
     int getWidth()  const override { return sx; }
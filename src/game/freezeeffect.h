@@ -51,6 +51,25 @@ public:
     float getTimer()        const { return timer; }
     bool  areBallsVisible() const { return ballsVisible; }
 
+    /**
+     * Timer state saved by scene snapshots (the blink action is recreated)
+     */
+    struct State
+    {
+        bool  active;
+        float timer;
+        bool  ballsVisible;
+    };
+
+    State getState() const { return { active, timer, ballsVisible }; }
+    void  setState(const State& s)
+    {
+        active = s.active;
+        timer = s.timer;
+        ballsVisible = s.ballsVisible;
+        blinkAction.reset();
+    }
+
 private:
     static constexpr float BLINK_WARN     = 3.0f;   ///< Seconds before end when balls start blinking
     static constexpr float BLINK_INTERVAL = 0.15f;  ///< Toggle interval in seconds
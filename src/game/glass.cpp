@@ -25,6 +25,20 @@ Glass::Glass(Scene* scn, int x, int y, GlassType type, int colorVal)
     }
 }
 
+Glass::Glass(const Glass& other)
+    : Platform(other), type(other.type), color(other.color), sx(other.sx), sy(other.sy),
+      scene(other.scene), hasDeathPickup(other.hasDeathPickup), deathPickupType(other.deathPickupType),
+      breaking(other.breaking)
+{
+    if (other.breakAnim)
+        breakAnim.reset(static_cast<FrameSequenceAnim*>(other.breakAnim->clone().release()));
+}
+
+std::unique_ptr<Platform> Glass::clone() const
+{
+    return std::make_unique<Glass>(*this);
+}
+
 void Glass::onHit()
 {
     if (breaking)
@@ -56,8 +56,11 @@ private:
 
 public:
     Glass(Scene* scene, int x, int y, GlassType type, int color = 0);
+    Glass(const Glass& other);  ///< Deep copy (clones the break animation)
     ~Glass() = default;
 
+    std::unique_ptr<Platform> clone() const override;
+
     void update(float dt) override;
 
     void setDeathPickup(PickupType type) { hasDeathPickup = true; deathPickupType = type; }
@@ -73,6 +76,7 @@ public:
     int getHeight() const override { return sy; }
 
     bool isDestructible() const override { return true; }
+    bool isAnimating() const override { return breaking; }
 
     Sprite* getCurrentSprite() const override;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include "gameobject.h"
 
 // Forward declarations
@@ -27,6 +28,11 @@ public:
 
     virtual void update(float dt) {}
 
+    /**
+     * @brief Deep copy of the concrete platform (used by scene snapshots)
+     */
+    virtual std::unique_ptr<Platform> clone() const = 0;
+
     /**
      * @brief Called when a weapon shot hits this platform.
      * Base implementation clears the invisible flag (reveals the platform).
@@ -41,6 +47,13 @@ public:
      */
     virtual bool isDestructible() const { return false; }
 
+    /**
+     * @brief Returns true while the platform's sprite changes from frame to frame
+     * (e.g., Glass breaking). Such platforms are drawn live instead of from
+     * the scene's static layer.
+     */
+    virtual bool isAnimating() const { return false; }
+
     /**
      * @brief Returns the sprite to render for this platform's current state.
      */
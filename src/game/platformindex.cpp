@@ -0,0 +1,45 @@
+#include "platformindex.h"
+#include "platform.h"
+#include "ladder.h"
+
+void PlatformIndex::rebuild(const std::list<std::unique_ptr<Platform>>& floors,
+                            const std::list<std::unique_ptr<Ladder>>& ladderList)
+{
+    platforms.clear();
+    ladders.clear();
+    maxPlatformWidth = 0;
+    maxLadderWidth = 0;
+
+    int order = 0;
+    for (const auto& floor : floors)
+    {
+        int idx = order++;
+        if (floor->isDead()) continue;
+
+        CollisionBox box = floor->getCollisionBox();
+        platforms.push_back({ floor.get(), box, idx });
+        maxPlatformWidth = std::max(maxPlatformWidth, box.w);
+    }
+
+    order = 0;
+    for (const auto& ladder : ladderList)
+    {
+        int idx = order++;
+        if (ladder->isDead()) continue;
+
+        // Cover both the collision box and the tile span used for standing checks
+        CollisionBox box = ladder->getCollisionBox();
+        int halfTile = ladder->getTileWidth() / 2;
+        int left = std::min(box.x, ladder->getCenterX() - halfTile);
+        int right = std::max(box.x + box.w, ladder->getCenterX() + halfTile);
+        ladders.push_back({ ladder.get(), left, right, idx });
+        maxLadderWidth = std::max(maxLadderWidth, right - left);
+    }
+
+    std::stable_sort(platforms.begin(), platforms.end(),
+        [](const PlatformEntry& a, const PlatformEntry& b) { return a.box.x < b.box.x; });
+    std::stable_sort(ladders.begin(), ladders.end(),
+        [](const LadderEntry& a, const LadderEntry& b) { return a.left < b.left; });
+
+    dirty = false;
+}
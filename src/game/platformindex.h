@@ -0,0 +1,99 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include "../core/collisionbox.h"
+
+class Platform;
+class Ladder;
+
+/**
+ * @class PlatformIndex
+ * @brief Immutable X-sorted interval index over the static stage geometry
+ *
+ * Holds every alive platform (including invisible ones, which callers
+ * filter themselves) and every alive ladder, sorted by left edge. Range
+ * queries binary-search the sorted array and only visit entries whose
+ * horizontal extent touches the query interval.
+ *
+ * Geometry never moves, so the index is only rebuilt when the set of
+ * objects changes: new geometry spawned, a Glass broken (removed), or an
+ * invisible floor revealed. Owners call invalidate() on those events and
+ * rebuild() lazily before the next query. SpatialQuery builds the
+ * gameplay queries (box, point, raycasts) on top of it.
+ *
+ * Each entry keeps its position in the source list (order) so callers can
+ * reproduce "first match in list order" semantics of a linear scan.
+ */
+class PlatformIndex
+{
+public:
+    struct PlatformEntry
+    {
+        Platform* platform;
+        CollisionBox box;   ///< Cached collision box
+        int order;          ///< Position in the source list
+    };
+
+    struct LadderEntry
+    {
+        Ladder* ladder;
+        int left, right;    ///< Horizontal extent (collision box and tile span)
+        int order;          ///< Position in the source list
+    };
+
+    PlatformIndex() = default;
+
+    /**
+     * @brief Rebuild from the scene's platform and ladder lists
+     */
+    void rebuild(const std::list<std::unique_ptr<Platform>>& floors,
+                 const std::list<std::unique_ptr<Ladder>>& ladders);
+
+    void invalidate() { dirty = true; }
+    bool isDirty() const { return dirty; }
+
+    int getPlatformCount() const { return (int)platforms.size(); }
+    int getLadderCount() const { return (int)ladders.size(); }
+
+    /**
+     * @brief Visit platforms whose [x, x + w] touches [left, right] (inclusive)
+     * @param fn Callable taking (const PlatformEntry&), visited in X order
+     */
+    template <typename Fn>
+    void forEachPlatform(int left, int right, Fn&& fn) const
+    {
+        auto it = std::lower_bound(platforms.begin(), platforms.end(), left - maxPlatformWidth,
+            [](const PlatformEntry& e, int x) { return e.box.x < x; });
+        for (; it != platforms.end() && it->box.x <= right; ++it)
+        {
+            if (it->box.x + it->box.w >= left)
+                fn(*it);
+        }
+    }
+
+    /**
+     * @brief Visit ladders whose [left, right] touches the query interval (inclusive)
+     * @param fn Callable taking (const LadderEntry&), visited in X order
+     */
+    template <typename Fn>
+    void forEachLadder(int left, int right, Fn&& fn) const
+    {
+        auto it = std::lower_bound(ladders.begin(), ladders.end(), left - maxLadderWidth,
+            [](const LadderEntry& e, int x) { return e.left < x; });
+        for (; it != ladders.end() && it->left <= right; ++it)
+        {
+            if (it->right >= left)
+                fn(*it);
+        }
+    }
+
+private:
+    std::vector<PlatformEntry> platforms;   ///< Sorted by box.x
+    std::vector<LadderEntry> ladders;       ///< Sorted by left
+    int maxPlatformWidth = 0;               ///< Widest platform (bounds the binary search)
+    int maxLadderWidth = 0;                 ///< Widest ladder span
+    bool dirty = true;
+};
@@ -47,6 +47,12 @@ int Scene::init()
         StageLoader::load(*stage, stage->stageFile);
     stage->skipFileReload = false;
 
+    reseed(gameinf.gameSeed);
+
+    // Start recording or verify playback against this stage
+    int stageNum = (int)(stage - gameinf.getStages()) + 1;
+    gameinf.replay.onSceneStart(stageNum, gameinf.gameSeed, gameinf.getPlayer(AppData::PLAYER2) ? 2 : 1);
+
     timeLine = 0;
     secondAccum = 0.0f;
     timeRemaining = stage->timelimit;
@@ -156,8 +162,8 @@ void Scene::subscribeToEvents()
                     // The shot was added to lsShoots just before this event fired
                     if (channel >= 0 && !lsShoots.empty()) {
                         // The most recent shot(s) belong to this player
-                        for (auto it = lsShoots.rbegin(); it != lsShoots.rend(); ++it) {
-                            Shot* shot = it->get();
+                        for (size_t i = lsShoots.size(); i-- > 0; ) {
+                            Shot* shot = lsShoots[i];
                             if (shot->getPlayer() == data.playerShoot.player &&
                                 shot->getAudioChannel() < 0) {
                                 shot->setAudioChannel(channel);
@@ -188,8 +194,7 @@ void Scene::subscribeToEvents()
             int cx = (int)ball->getX() + ball->getDiameter() / 2;
             int cy = (int)ball->getY() - 10;
             int score = 1000 / ball->getDiameter();
-            lsHitScores.push_back(
-                std::make_unique<HitScore>(&hitScoreFontRenderer, cx, cy, score));
+            lsHitScores.acquire()->reset(&hitScoreFontRenderer, cx, cy, score);
         });
 
     // Subscribe to hexa hit event to spawn floating score popups
@@ -199,8 +204,7 @@ void Scene::subscribeToEvents()
             int cx = (int)hexa->getX() + hexa->getWidth() / 2;
             int cy = (int)hexa->getY() - 10;
             int score = 1000 / hexa->getWidth();
-            lsHitScores.push_back(
-                std::make_unique<HitScore>(&hitScoreFontRenderer, cx, cy, score));
+            lsHitScores.acquire()->reset(&hitScoreFontRenderer, cx, cy, score);
         });
 
     // Subscribe to pickup collected event for pickup sound effect
@@ -241,6 +245,7 @@ int Scene::initBitmaps()
     std::snprintf(txt, sizeof(txt), "assets/graph/bg/%s", stage->back);
     bmp.back.init(&appGraph, txt, 16, 16);
     appGraph.setColorKey(bmp.back.getBmp(), 0x00FF00);
+    staticLayer.invalidate();
 
     // Initialize font renderers using shared resources
     StageResources& res = gameinf.getStageRes();
@@ -289,7 +294,13 @@ void Scene::addBall(int x, int y, int size, int top, float dirX, int dirY, int i
         checkValidPosition(x, y, ballDiameter);
     }
     
-    lsBalls.push_back(std::make_unique<Ball>(this, x, y, size, dirX, dirY, top, id));
+    lsBalls.emplace(this, x, y, size, dirX, dirY, top, id);
+}
+
+void Scene::reseed(Uint32 seed)
+{
+    rng.reseed(Random::deriveSeed(seed, (uint64_t)stage->id));
+    LOG_DEBUG("Scene RNG seeded (game seed %u, stage %d)", seed, stage->id);
 }
 
 void Scene::checkValidPosition(int& x, int& y, int ballDiameter)
@@ -307,12 +318,12 @@ void Scene::checkValidPosition(int& x, int& y, int ballDiameter)
     // Calculate initial positions for INT_MAX coordinates
     if (xWasRandom)
     {
-        x = std::rand() % 600 + 32; // Random X in range [32, 632)
+        x = rng.range(32, 632); // Random X in range [32, 632)
     }
     
     if (yWasRandom)
     {
-        y = std::rand() % 394 + 22; // Random Y in range [22, 415) - playable area
+        y = rng.range(22, 416); // Random Y in range [22, 415] - playable area
     }
     
     // Try to find valid position (up to 10 attempts)
@@ -320,44 +331,36 @@ void Scene::checkValidPosition(int& x, int& y, int ballDiameter)
     int attempts = 0;
     const int maxAttempts = 10;
     
+    // Spawn collision box of a size-0 red ball (same as Ball::getCollisionBox())
+    const int diameter = Ball::diameterFor(0, 0);
+    SpatialQuery query = getSpatialQuery();
+
     while (!validPosition && attempts < maxAttempts)
     {
         validPosition = true;
-        
-        // Create temporary ball for collision checking using existing Ball::collision() method
-        Ball tempBall(this, x, y, 0, 1, 1, 0, 0);
-        
-        // Check for collisions with existing floors in scene using Ball's collision method
-        for (const auto& floor : lsFloor)
+
+        // First alive floor in list order overlapping the ball (invisible floors count too)
+        Platform* floor = query.firstInBox({ x, y, diameter, diameter }, SpatialQuery::INCLUDE_INVISIBLE);
+        if (floor)
         {
-            // Skip dead floors
-            if (floor->isDead())
-                continue;
-            
-            // Use existing Ball::collision(Platform*) method
-            if (tempBall.collision(floor.get()))
+            // Collision detected! Generate new random position
+            validPosition = false;
+
+            LOG_DEBUG("Cannot spawn ball at (x=%d, y=%d) => (floor x=%d, y=%d, w=%d, h=%d) ## COLLISION",
+                x, y, floor->getX(), floor->getY(), floor->getWidth(), floor->getHeight());
+
+            // Regenerate ONLY the coordinates that were originally random
+            if (xWasRandom)
             {
-                // Collision detected! Generate new random position
-                validPosition = false;
-
-                LOG_DEBUG("Cannot spawn ball at (x=%d, y=%d) => (floor x=%d, y=%d, w=%d, h=%d) ## COLLISION",
-                    x, y, floor->getX(), floor->getY(), floor->getWidth(), floor->getHeight());
-                
-                // Regenerate ONLY the coordinates that were originally random
-                if (xWasRandom)
-                {
-                    x = std::rand() % 600 + 32;
-                }
-                
-                if (yWasRandom)
-                {
-                    y = std::rand() % 394 + 22;
-                }
-                
-                break;
+                x = rng.range(32, 632);
+            }
+
+            if (yWasRandom)
+            {
+                y = rng.range(22, 416);
             }
         }
-        
+
         attempts++;
     }
     
@@ -375,27 +378,40 @@ void Scene::checkValidPosition(int& x, int& y, int ballDiameter)
 
 void Scene::addPickup(int x, int y, PickupType type)
 {
-    lsPickups.push_back(std::make_unique<Pickup>(this, x, y, type));
+    lsPickups.emplace(this, x, y, type);
 }
 
 void Scene::addFloor(int x, int y, FloorType type, int color)
 {
     lsFloor.push_back(std::make_unique<Floor>(this, x, y, type, color));
+    platformIndex.invalidate();
+    staticLayer.invalidate();
 }
 
 void Scene::addGlass(int x, int y, GlassType type, int color)
 {
     lsFloor.push_back(std::make_unique<Glass>(this, x, y, type, color));
+    platformIndex.invalidate();
+    staticLayer.invalidate();
 }
 
 void Scene::addLadder(int x, int y, int numTiles)
 {
     lsLadders.push_back(std::make_unique<Ladder>(this, x, y, numTiles));
+    platformIndex.invalidate();
+    staticLayer.invalidate();
 }
 
 void Scene::addHexa(int x, int y, int size, float velX, float velY, int color)
 {
-    lsHexas.push_back(std::make_unique<Hexa>(this, x, y, size, velX, velY, color));
+    lsHexas.emplace(this, x, y, size, velX, velY, color);
+}
+
+const PlatformIndex& Scene::getPlatformIndex() const
+{
+    if (platformIndex.isDirty())
+        platformIndex.rebuild(lsFloor, lsLadders);
+    return platformIndex;
 }
 
 Ladder* Scene::findLadderAtPlayer(Player* player) const
@@ -404,9 +420,17 @@ Ladder* Scene::findLadderAtPlayer(Player* player) const
 
     CollisionBox playerBox = player->getCollisionBox();
 
-    for (const auto& ladder : lsLadders)
+    // Index visits ladders in X order; keep the first match in list order
+    Ladder* found = nullptr;
+    int foundOrder = INT_MAX;
+
+    getPlatformIndex().forEachLadder(playerBox.x, playerBox.x + playerBox.w,
+        [&](const PlatformIndex::LadderEntry& entry)
     {
-        if (ladder->isDead()) continue;
+        if (entry.order >= foundOrder) return;
+
+        Ladder* ladder = entry.ladder;
+        if (ladder->isDead()) return;
 
         CollisionBox ladderBox = ladder->getCollisionBox();
 
@@ -420,11 +444,12 @@ Ladder* Scene::findLadderAtPlayer(Player* player) const
             // Check horizontal overlap using 50% rule
             if (has50PercentOverlap(playerBox, ladderBox))
             {
-                return ladder.get();
+                found = ladder;
+                foundOrder = entry.order;
             }
         }
-    }
-    return nullptr;
+    });
+    return found;
 }
 
 Ladder* Scene::findLadderBelowPlayer(Player* player) const
@@ -434,9 +459,16 @@ Ladder* Scene::findLadderBelowPlayer(Player* player) const
     CollisionBox playerBox = player->getCollisionBox();
     int playerBottom = playerBox.y + playerBox.h;
 
-    for (const auto& ladder : lsLadders)
+    Ladder* found = nullptr;
+    int foundOrder = INT_MAX;
+
+    getPlatformIndex().forEachLadder(playerBox.x, playerBox.x + playerBox.w,
+        [&](const PlatformIndex::LadderEntry& entry)
     {
-        if (ladder->isDead()) continue;
+        if (entry.order >= foundOrder) return;
+
+        Ladder* ladder = entry.ladder;
+        if (ladder->isDead()) return;
 
         // Check if player is within the top entry zone of the ladder.
         // The ladder graphic often protrudes slightly above the floor surface, so the
@@ -452,11 +484,12 @@ Ladder* Scene::findLadderBelowPlayer(Player* player) const
             // Check horizontal overlap using 50% rule
             if (has50PercentOverlap(playerBox, ladderBox))
             {
-                return ladder.get();
+                found = ladder;
+                foundOrder = entry.order;
             }
         }
-    }
-    return nullptr;
+    });
+    return found;
 }
 
 Platform* Scene::findFloorUnderPlayer(Player* player) const
@@ -473,34 +506,10 @@ Platform* Scene::findFloorUnderPlayer(Player* player) const
     int playerLeft = (int)(playerCenterX - SURFACE_CHECK_WIDTH / 2);
     int playerRight = (int)(playerCenterX + SURFACE_CHECK_WIDTH / 2);
 
-    Platform* bestFloor = nullptr;
-    int closestY = Stage::MAX_Y + 1;
-
-    for (const auto& floor : lsFloor)
-    {
-        if (floor->isDead() || floor->isInvisible()) continue;
-
-        CollisionBox floorBox = floor->getCollisionBox();
-        int floorLeft = floorBox.x;
-        int floorRight = floorBox.x + floorBox.w;
-        int floorTopY = floorBox.y;
-
-        // Floor top must be at or below player's feet (within tolerance for landing)
-        if (floorTopY < (int)playerFeetY - SURFACE_STEP_TOLERANCE) continue;
-
-        // Check horizontal overlap - player BB must overlap floor BB by at least 1 pixel
-        int overlapWidth = calculateHorizontalOverlap(playerLeft, playerRight, floorLeft, floorRight);
-        if (overlapWidth < 1) continue;
-
-        // Find closest floor below (or at feet level)
-        if (floorTopY < closestY)
-        {
-            closestY = floorTopY;
-            bestFloor = floor.get();
-        }
-    }
-
-    return bestFloor;
+    // Closest floor top at or below the feet (within tolerance for landing) that the
+    // check width overlaps by at least 1 pixel; ties go to the earliest in list order
+    return getSpatialQuery().nearestPlatformBelow(playerLeft, playerRight,
+                                                  (int)playerFeetY - SURFACE_STEP_TOLERANCE);
 }
 
 Ladder* Scene::findLadderTopUnderPlayer(Player* player) const
@@ -516,32 +525,36 @@ Ladder* Scene::findLadderTopUnderPlayer(Player* player) const
     int playerRight = (int)(playerCenterX + SURFACE_CHECK_WIDTH / 2);
 
     Ladder* bestLadder = nullptr;
+    int bestOrder = INT_MAX;
     int closestY = Stage::MAX_Y + 1;
 
-    for (const auto& ladder : lsLadders)
+    getPlatformIndex().forEachLadder(playerLeft, playerRight,
+        [&](const PlatformIndex::LadderEntry& entry)
     {
-        if (ladder->isDead()) continue;
+        Ladder* ladder = entry.ladder;
+        if (ladder->isDead()) return;
 
         int ladderTopY = ladder->getTopY();
         int ladderLeft = ladder->getCenterX() - ladder->getTileWidth() / 2;
         int ladderRight = ladder->getCenterX() + ladder->getTileWidth() / 2;
 
         // Ladder top must be at or below player's feet (within tolerance)
-        if (ladderTopY < (int)playerFeetY - SURFACE_STEP_TOLERANCE) continue;
+        if (ladderTopY < (int)playerFeetY - SURFACE_STEP_TOLERANCE) return;
 
         // Check horizontal overlap - player BB must overlap ladder BB by at least 1 pixel
         int overlapWidth = calculateHorizontalOverlap(playerLeft, playerRight, ladderLeft, ladderRight);
-        if (overlapWidth < 1) continue;
+        if (overlapWidth < 1) return;
 
-        // Find closest ladder top below (or at feet level)
-        if (ladderTopY < closestY)
+        // Find closest ladder top below (or at feet level); ties go to the earliest in list order
+        if (ladderTopY < closestY || (bestLadder && ladderTopY == closestY && entry.order < bestOrder))
         {
             closestY = ladderTopY;
-            bestLadder = ladder.get();
+            bestLadder = ladder;
+            bestOrder = entry.order;
             LOG_TRACE("Ladder top candidate: ladderTopY=%d, playerFeetY=%.1f, overlapW=%d",
                       ladderTopY, playerFeetY, overlapWidth);
         }
-    }
+    });
 
     return bestLadder;
 }
@@ -596,25 +609,14 @@ Platform* Scene::findSteppablePlatformInPath(Player* player) const
     int playerLeft  = (int)(player->getX() - SURFACE_CHECK_WIDTH / 2);
     int playerRight = (int)(player->getX() + SURFACE_CHECK_WIDTH / 2);
 
-    for (const auto& floor : lsFloor)
+    // Player center must overlap the platform horizontally (same as findFloorUnderPlayer)
+    return getSpatialQuery().firstInSpan(playerLeft, playerRight, SpatialQuery::SOLID,
+        [&](const PlatformIndex::PlatformEntry& entry)
     {
-        if (floor->isDead() || floor->isInvisible()) continue;
-        CollisionBox floorBox = floor->getCollisionBox();
-
         // Step height: distance from player's feet to platform top
-        int floorTopY = floorBox.y;
-        float stepHeight = playerFeetY - (float)floorTopY;
-        if (stepHeight <= 0.0f || stepHeight > (float)MAX_STEP_HEIGHT) continue;
-
-        // Player center must overlap the platform horizontally (same as findFloorUnderPlayer)
-        int overlap = calculateHorizontalOverlap(
-            playerLeft, playerRight,
-            floorBox.x, floorBox.x + floorBox.w);
-        if (overlap < 1) continue;
-
-        return floor.get();
-    }
-    return nullptr;
+        float stepHeight = playerFeetY - (float)entry.box.y;
+        return stepHeight > 0.0f && stepHeight <= (float)MAX_STEP_HEIGHT;
+    });
 }
 
 Platform* Scene::findWallBlockingPlayer(Player* player) const
@@ -626,23 +628,14 @@ Platform* Scene::findWallBlockingPlayer(Player* player) const
     CollisionBox playerBox = player->getCollisionBox();
     float playerFeetY = player->getY();
 
-    for (const auto& floor : lsFloor)
+    // Full AABB intersection with a solid, non-passthrough platform
+    return getSpatialQuery().firstInBox(playerBox, SpatialQuery::SKIP_PASSTHROUGH,
+        [&](const PlatformIndex::PlatformEntry& entry)
     {
-        if (floor->isDead() || floor->isInvisible() || floor->isPassthrough()) continue;
-
-        CollisionBox floorBox = floor->getCollisionBox();
-
-        // Full AABB intersection required
-        if (!intersects(playerBox, floorBox)) continue;
-
         // Exclude step-up candidates: when grounded and floor top is within step range below feet
-        float stepHeight = playerFeetY - (float)floorBox.y;
-        if (player->isGrounded() && stepHeight >= 0.0f && stepHeight <= (float)MAX_STEP_HEIGHT)
-            continue;
-
-        return floor.get();
-    }
-    return nullptr;
+        float stepHeight = playerFeetY - (float)entry.box.y;
+        return !(player->isGrounded() && stepHeight >= 0.0f && stepHeight <= (float)MAX_STEP_HEIGHT);
+    });
 }
 
 /**
@@ -651,24 +644,24 @@ Platform* Scene::findWallBlockingPlayer(Player* player) const
  * @param type Weapon type
  * @return unique_ptr to created Shot object
  */
-std::unique_ptr<Shot> Scene::createShot(Player* pl, WeaponType type)
+Shot* Scene::createShot(Player* pl, WeaponType type)
 {
     StageResources& res = gameinf.getStageRes();
 
     switch (type)
     {
     case WeaponType::HARPOON:
-        return std::make_unique<HarpoonShot>(this, pl, type);
+        return lsShoots.emplace<HarpoonShot>(this, pl, type);
 
     case WeaponType::GUN:
-        return std::make_unique<GunShot>(this, pl, res.gunBulletAnim.get());
+        return lsShoots.emplace<GunShot>(this, pl, res.gunBulletAnim.get());
 
     case WeaponType::CLAW:
-        return std::make_unique<ClawShot>(this, pl, type);
+        return lsShoots.emplace<ClawShot>(this, pl, type);
 
     default:
         // Fallback to harpoon for unknown types
-        return std::make_unique<HarpoonShot>(this, pl, WeaponType::HARPOON);
+        return lsShoots.emplace<HarpoonShot>(this, pl, WeaponType::HARPOON);
     }
 }
 
@@ -678,7 +671,7 @@ void Scene::shoot(Player* pl)
 
     const WeaponConfig& config = WeaponConfig::get(pl->getWeapon());
 
-    lsShoots.push_back(createShot(pl, pl->getWeapon()));
+    createShot(pl, pl->getWeapon());
 
     pl->shoot();  // Updates player state and animation
 
@@ -933,64 +926,43 @@ void Scene::checkSequence()
 
 void Scene::cleanupBalls()
 {
-    // Clean up dead balls and create children
-    for (auto it = lsBalls.begin(); it != lsBalls.end(); )
+    // Clean up dead balls and create children. Children are appended to the
+    // pool while it is compacted; they are alive, so the scan just skips them.
+    for (size_t i = 0; i < lsBalls.size(); )
     {
-        if ((*it)->isDead())
+        Ball* ball = lsBalls[i];
+        if (ball->isDead())
         {
-            // Ask ball to create its children
-            auto children = (*it)->createChildren();
-
-            if (children.first)
-                pendingBalls.push_back(std::move(children.first));
-            if (children.second)
-                pendingBalls.push_back(std::move(children.second));
-
-            it = lsBalls.erase(it);  // unique_ptr automatically deletes
+            // Ask ball to create its children (reads the parent, so erase after)
+            ball->createChildren(lsBalls);
+            lsBalls.erase(i);  // swap-and-pop: re-check index i
         }
         else
         {
-            ++it;
+            ++i;
         }
     }
-
-    // Add children to active list
-    for (auto& b : pendingBalls)
-        lsBalls.push_back(std::move(b));
-    pendingBalls.clear();
 }
 
 void Scene::cleanupHexas()
 {
-    // Clean up dead hexas and create children
-    for (auto it = lsHexas.begin(); it != lsHexas.end(); )
+    // Clean up dead hexas and create children (same scheme as cleanupBalls)
+    for (size_t i = 0; i < lsHexas.size(); )
     {
-        if ((*it)->isDead())
+        Hexa* hexa = lsHexas[i];
+        if (hexa->isDead())
         {
-            // Ask hexa to create its children
-            auto children = (*it)->createChildren();
-
-            if (children.first)
-                pendingHexas.push_back(std::move(children.first));
-            if (children.second)
-                pendingHexas.push_back(std::move(children.second));
-
-            it = lsHexas.erase(it);  // unique_ptr automatically deletes
+            hexa->createChildren(lsHexas);
+            lsHexas.erase(i);
         }
         else
         {
-            ++it;
+            ++i;
         }
     }
 
-    // Add children to active list
-    for (auto& h : pendingHexas)
-        lsHexas.push_back(std::move(h));
-    pendingHexas.clear();
-
     // Check win condition after all ball AND hexa removals
-    if (lsBalls.empty() && pendingBalls.empty() &&
-        lsHexas.empty() && pendingHexas.empty() && !stage->getItemsLeft())
+    if (lsBalls.empty() && lsHexas.empty() && !stage->getItemsLeft())
     {
         // Only trigger win once - prevent calling every frame
         if (currentState != SceneState::LevelClear)
@@ -1059,13 +1031,35 @@ void Scene::updateEntities(float dt)
     // Update freeze timer and ball-blink
     freezeEffect.update(dt);
 
+    // Start of this step's path for swept collision, checked by the next
+    // detectAndResolve() (which runs before movement)
+    for (const auto& ball : lsBalls)
+        ball->storeStepStart();
+    for (const auto& hexa : lsHexas)
+        hexa->storeStepStart();
+
     // Balls and hexas only move when NOT frozen, but flashing entities
     // still need to update their flash timer to complete the death sequence
     if (!freezeEffect.isActive())
     {
-        for (const auto& ball : lsBalls)
+        if (lsBalls.size() >= BallKernel::MIN_BATCH)
         {
-            ball->update(dt);
+            // Many balls: move them in place in the pool's SoA/SIMD motion
+            // store (bit-identical to Ball::update). Flashing balls are
+            // masked out there and only run their countdown here.
+            lsBalls.getMotion().step(dt);
+            for (Ball* ball : lsBalls)
+            {
+                if (ball->isInFlashState())
+                    ball->update(dt);
+            }
+        }
+        else
+        {
+            for (const auto& ball : lsBalls)
+            {
+                ball->update(dt);
+            }
         }
         for (const auto& hexa : lsHexas)
         {
@@ -1122,7 +1116,7 @@ void Scene::updateEntities(float dt)
 void Scene::spawnEffect(AnimSpriteSheet* tmpl, int x, int y, float scale)
 {
     if (tmpl)
-        lsEffects.push_back(std::make_unique<AnimEffect>(x, y, tmpl, scale));
+        lsEffects.acquire()->reset(x, y, tmpl, scale);
 }
 
 void Scene::cleanupPhase()
@@ -1136,8 +1130,19 @@ void Scene::cleanupPhase()
 
     // Standard cleanup for shots, floors, ladders, pickups, and effects (unique_ptr)
     cleanupDeadObjects(lsShoots);
+
+    // Static geometry removed (e.g. broken Glass) invalidates the platform index
+    size_t floorCount = lsFloor.size();
+    size_t ladderCount = lsLadders.size();
+    for (const auto& floor : lsFloor)
+    {
+        if (floor->isDead())
+            invalidateStaticLayer(floor.get());
+    }
     cleanupDeadObjects(lsFloor);
     cleanupDeadObjects(lsLadders);
+    if (lsFloor.size() != floorCount || lsLadders.size() != ladderCount)
+        platformIndex.invalidate();
     cleanupDeadObjects(lsPickups);
     cleanupDeadObjects(lsEffects);
     cleanupDeadObjects(lsHitScores);
@@ -1449,9 +1454,10 @@ GameState* Scene::handlePlayingState(float dt)
         lsFloor,
         lsPickups,
         { gameinf.player[AppData::PLAYER1].get(), gameinf.player[AppData::PLAYER2].get() },
-        true  // checkPlayerCollisions = true during Playing state
+        true,  // checkPlayerCollisions = true during Playing state
+        dt     // swept bounces finish the step
     };
-    ContactList contacts = collisionSystem.detectAndResolve(ctx);
+    const ContactList& contacts = collisionSystem.detectAndResolve(ctx);
 
     // Phase 2: Apply game rules to contacts
     gameRules.processContacts(contacts, this);
@@ -1521,6 +1527,29 @@ GameState* Scene::updateStageProgression(float dt)
 }
 
 GameState* Scene::moveAll(float dt)
+{
+    // Sample (recording) or inject (playback) this tick's gameplay keys
+    gameinf.replay.onTick();
+
+    GameState* result = stepSimulation(dt);
+
+    // Record or verify the resulting world state
+    if (gameinf.replay.wantsWorldHash())
+        gameinf.replay.onTickEnd(computeWorldHash());
+
+    // Restart point and rewind history
+    if (!result && canSnapshot())
+    {
+        if (!startSnapshot.valid)
+            saveSnapshot(startSnapshot);
+        if (rewindRing.due())
+            saveSnapshot(rewindRing.push());
+    }
+
+    return result;
+}
+
+GameState* Scene::stepSimulation(float dt)
 {
     updateFPSCounters();
 
@@ -1568,8 +1597,239 @@ GameState* Scene::moveAll(float dt)
     return updateStageProgression(dt);
 }
 
+WorldHash Scene::computeWorldHash() const
+{
+    WorldHash hash;
+    StateHasher h;
+
+    for (const auto& ball : lsBalls)
+    {
+        h.add(ball->getX()); h.add(ball->getY());
+        h.add(ball->getDirX()); h.add(ball->getDirY());
+        h.add(ball->getSize()); h.add(ball->getTime());
+        h.add(ball->isDead());
+    }
+    hash.parts[WorldHash::Balls] = h.get();
+
+    h = StateHasher();
+    for (const auto& hexa : lsHexas)
+    {
+        h.add(hexa->getX()); h.add(hexa->getY());
+        h.add(hexa->getVelX()); h.add(hexa->getVelY());
+        h.add(hexa->getSize()); h.add(hexa->isDead());
+    }
+    hash.parts[WorldHash::Hexas] = h.get();
+
+    h = StateHasher();
+    for (const auto& shot : lsShoots)
+    {
+        h.add(shot->getX()); h.add(shot->getY()); h.add(shot->getGunY());
+        h.add((int)shot->getWeaponType()); h.add(shot->isDead());
+    }
+    hash.parts[WorldHash::Shots] = h.get();
+
+    h = StateHasher();
+    for (const auto& pickup : lsPickups)
+    {
+        h.add(pickup->getX()); h.add(pickup->getY());
+        h.add((int)pickup->getType()); h.add(pickup->isDead());
+    }
+    hash.parts[WorldHash::Pickups] = h.get();
+
+    h = StateHasher();
+    for (const auto& floor : lsFloor)
+    {
+        h.add(floor->getX()); h.add(floor->getY());
+        h.add(floor->getWidth()); h.add(floor->getHeight());
+        h.add(floor->isDead()); h.add(floor->isInvisible());
+    }
+    hash.parts[WorldHash::Floors] = h.get();
+
+    h = StateHasher();
+    for (int i = 0; i < 2; i++)
+    {
+        Player* p = gameinf.getPlayer(i);
+        if (!p) continue;
+        h.add(p->getX()); h.add(p->getY()); h.add(p->getYVelocity());
+        h.add((int)p->getState()); h.add((int)p->getFacing());
+        h.add(p->getLives()); h.add(p->getScore());
+        h.add(p->getNumShoots()); h.add((int)p->getWeapon());
+        h.add(p->isPlaying()); h.add(p->isImmune()); h.add(p->getShield());
+    }
+    hash.parts[WorldHash::Players] = h.get();
+
+    h = StateHasher();
+    h.add((int)currentState);
+    h.add(timeRemaining);
+    h.add(timeLine);
+    h.add(secondAccum);
+    hash.parts[WorldHash::Timers] = h.get();
+
+    return hash;
+}
+
+bool Scene::canSnapshot() const
+{
+    if (currentState != SceneState::Playing)
+        return false;
+
+    for (int i = 0; i < 2; i++)
+    {
+        Player* p = gameinf.getPlayer(i);
+        if (p && p->isDying())
+            return false;
+    }
+
+    return true;
+}
+
+bool Scene::saveSnapshot(SceneSnapshot& out) const
+{
+    if (!canSnapshot())
+        return false;
+
+    out.balls.clear();
+    for (const Ball* ball : lsBalls)
+        out.balls.emplace(*ball);
+
+    out.hexas.clear();
+    for (const Hexa* hexa : lsHexas)
+        out.hexas.emplace(*hexa);
+
+    out.shots.clear();
+    for (const Shot* shot : lsShoots)
+        out.shots.emplaceWith([shot](void* memory) { return shot->cloneInto(memory); });
+
+    out.floors.clear();
+    for (const auto& floor : lsFloor)
+        out.floors.push_back(floor->clone());
+
+    // Pickups refer to the platform they rest on; store it as a list index
+    out.pickups.clear();
+    out.pickupPlatforms.clear();
+    for (const Pickup* pickup : lsPickups)
+    {
+        int platformIdx = -1;
+        int idx = 0;
+        for (const auto& floor : lsFloor)
+        {
+            if (floor.get() == pickup->getLandedPlatform())
+            {
+                platformIdx = idx;
+                break;
+            }
+            idx++;
+        }
+        out.pickups.emplace(*pickup);
+        out.pickupPlatforms.push_back(platformIdx);
+    }
+
+    out.ladderCount = lsLadders.size();
+
+    for (int i = 0; i < 2; i++)
+    {
+        Player* p = gameinf.getPlayer(i);
+        out.hasPlayer[i] = (p != nullptr);
+        if (p)
+            out.players[i] = p->saveSnapshot();
+        out.shootKeyWasDown[i] = shootKeyWasDown[i];
+    }
+
+    out.stageCursor = stage->getCursor();
+    out.freeze = freezeEffect.getState();
+    out.rng = rng;
+    out.stageOnce = stageOnceHelper;
+    out.timeRemaining = timeRemaining;
+    out.timeLine = timeLine;
+    out.secondAccum = secondAccum;
+    out.valid = true;
+    return true;
+}
+
+bool Scene::restoreSnapshot(const SceneSnapshot& snap)
+{
+    if (!snap.valid || currentState == SceneState::LevelClear)
+        return false;
+
+    // A replay is one uninterrupted run: a jump back would make it unplayable
+    if (gameinf.replay.isRecording() || gameinf.replay.isPlaying())
+        return false;
+
+    lsBalls.clear();
+    for (const Ball* ball : snap.balls)
+        lsBalls.emplace(*ball);
+
+    lsHexas.clear();
+    for (const Hexa* hexa : snap.hexas)
+        lsHexas.emplace(*hexa);
+
+    lsShoots.clear();
+    for (const Shot* shot : snap.shots)
+        lsShoots.emplaceWith([shot](void* memory) { return shot->cloneInto(memory); });
+
+    std::vector<Platform*> floors;
+    floors.reserve(snap.floors.size());
+    lsFloor.clear();
+    for (const auto& floor : snap.floors)
+    {
+        lsFloor.push_back(floor->clone());
+        floors.push_back(lsFloor.back().get());
+    }
+
+    lsPickups.clear();
+    for (size_t i = 0; i < snap.pickups.size(); i++)
+    {
+        Pickup* pickup = lsPickups.emplace(*snap.pickups[i]);
+        int platformIdx = snap.pickupPlatforms[i];
+        pickup->setLandedPlatform(platformIdx >= 0 ? floors[platformIdx] : nullptr);
+    }
+
+    // Effects and score popups are not captured; the ones on screen belong to the abandoned timeline
+    lsEffects.clear();
+    lsHitScores.clear();
+
+    // Ladders are only ever appended: drop the ones spawned after the snapshot
+    while (lsLadders.size() > snap.ladderCount)
+        lsLadders.pop_back();
+    platformIndex.invalidate();
+    staticLayer.invalidate();
+
+    for (int i = 0; i < 2; i++)
+    {
+        Player* p = gameinf.getPlayer(i);
+        if (p && snap.hasPlayer[i])
+        {
+            Ladder* ladder = snap.players[i].currentLadder;
+            bool ladderValid = (ladder == nullptr);
+            for (const auto& l : lsLadders)
+            {
+                if (l.get() == ladder)
+                {
+                    ladderValid = true;
+                    break;
+                }
+            }
+            p->restoreSnapshot(snap.players[i], ladderValid);
+        }
+        shootKeyWasDown[i] = snap.shootKeyWasDown[i];
+    }
+
+    stage->setCursor(snap.stageCursor);
+    freezeEffect.setState(snap.freeze);
+    rng = snap.rng;
+    stageOnceHelper = snap.stageOnce;
+    timeRemaining = snap.timeRemaining;
+    timeLine = snap.timeLine;
+    secondAccum = snap.secondAccum;
+    setState(SceneState::Playing);
+    return true;
+}
+
 int Scene::release()
 {
+    // A replay covers a single stage
+    gameinf.replay.onSceneEnd();
+
     // Unsubscribe from all events
     unsubscribeFromEvents();
 
@@ -1580,9 +1840,11 @@ int Scene::release()
     lsFloor.clear();
     lsLadders.clear();
     lsPickups.clear();
+    platformIndex.invalidate();
 
-    // Release only scene-specific sprites (background)
+    // Release only scene-specific sprites (background) and the static layer cache
     bmp.back.release();
+    staticLayer.release();
 
     // Shared resources (balls, floors, UI, fonts, weapons) are managed by AppData
     // and persist across scene transitions
@@ -1598,6 +1860,33 @@ void Scene::drawBackground()
     appGraph.draw(&bmp.back, 0, 0);
 }
 
+void Scene::storePrevPositions()
+{
+    for (const auto& ball : lsBalls)
+        ball->storePrevPos();
+
+    for (const auto& hexa : lsHexas)
+        hexa->storePrevPos();
+
+    for (const auto& shot : lsShoots)
+        shot->storePrevPos();
+
+    for (const auto& pickup : lsPickups)
+        pickup->storePrevPos();
+
+    for (const auto& effect : lsEffects)
+        effect->storePrevPos();
+
+    for (const auto& hs : lsHitScores)
+        hs->storePrevPos();
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (Player* pl = gameinf.getPlayer(i))
+            pl->storePrevPos();
+    }
+}
+
 void Scene::draw(Ball* b)
 {
     if (!freezeEffect.areBallsVisible()) return;  // Hidden during freeze-warning blink
@@ -1606,8 +1895,8 @@ void Scene::draw(Ball* b)
     if (!spr) return;
 
     RenderProps props;
-    props.x = (int)b->getX();
-    props.y = (int)b->getY();
+    props.x = (int)b->getRenderX(renderAlpha);
+    props.y = (int)b->getRenderY(renderAlpha);
 
     appGraph.drawExFlash(spr, props, b->isInFlashState());
 }
@@ -1620,15 +1909,15 @@ void Scene::draw(Hexa* h)
     if (!spr) return;
 
     RenderProps props;
-    props.x = (int)h->getX();
-    props.y = (int)h->getY();
+    props.x = (int)h->getRenderX(renderAlpha);
+    props.y = (int)h->getRenderY(renderAlpha);
 
     appGraph.drawExFlash(spr, props, h->isInFlashState());
 }
 
 void Scene::draw(Player* pl)
 {
-    pl->draw(&appGraph);
+    pl->draw(&appGraph, renderAlpha);
 }
 
 void Scene::draw(Platform* pl)
@@ -1827,7 +2116,7 @@ void Scene::drawBoundingBoxes()
             int yInit = (int)s->getYInit();
 
             // Check if this is a GunShot
-            GunShot* gunShot = dynamic_cast<GunShot*>(s.get());
+            GunShot* gunShot = dynamic_cast<GunShot*>(s);
 
             if (gunShot)
             {
@@ -1903,6 +2192,8 @@ void Scene::drawDebugOverlay()
     // Call base class to populate default section with basic info
     GameState::drawDebugOverlay();
 
+    textOverlay.addTextF("Seed = %u  Stage = %d", appData.gameSeed, stage->id);
+
     // Add player info to default section
     if (appData.getPlayer(AppData::PLAYER1))
     {
@@ -1958,55 +2249,121 @@ void Scene::drawDebugOverlay()
             currentState == SceneState::LevelClear ? "LevelClear" : "Unknown");
 }
 
-void Scene::drawEntities()
+void Scene::onSDLEvent(const SDL_Event& e)
+{
+    // Target contents are gone after a reset; after a device reset the texture too
+    if (e.type == SDL_RENDER_DEVICE_RESET)
+        staticLayer.release();
+    else if (e.type == SDL_RENDER_TARGETS_RESET)
+        staticLayer.invalidate();
+}
+
+bool Scene::drawStaticLayer()
 {
-    // Draw floors
+    if (!staticLayerEnabled)
+        return false;
+    return staticLayer.draw(appGraph, [this]() { drawStaticContent(); });
+}
+
+void Scene::drawStaticContent()
+{
+    appGraph.setLayer(LAYER_BACKGROUND);
+    drawBackground();
+
+    appGraph.setLayer(LAYER_FLOORS);
     for (const auto& floor : lsFloor)
     {
-        draw(floor.get());
+        if (!floor->isAnimating())
+            draw(floor.get());
     }
 
-    // Draw ladders (over floors, below shots/balls/players)
+    appGraph.setLayer(LAYER_LADDERS);
     for (const auto& ladder : lsLadders)
     {
         ladder->draw(appGraph);
     }
+}
+
+void Scene::invalidateStaticLayer(const Platform* platform)
+{
+    CollisionBox box = platform->getCollisionBox();
+    SDL_Rect area = { box.x, box.y, box.w, box.h };
+    if (Sprite* spr = platform->getCurrentSprite())
+    {
+        SDL_Rect drawn = { (int)platform->getX() + spr->getXOff(), (int)platform->getY() + spr->getYOff(),
+                           spr->getWidth(), spr->getHeight() };
+        SDL_UnionRect(&area, &drawn, &area);
+    }
+    staticLayer.invalidate(area);
+}
+
+void Scene::drawEntities(bool staticCached)
+{
+    // Everything below is queued and flushed as one draw call per layer and
+    // texture run when the batch ends
+    appGraph.beginBatch();
+
+    // Draw floors (only breaking ones when the static layer holds the still ones)
+    appGraph.setLayer(LAYER_FLOORS);
+    for (const auto& floor : lsFloor)
+    {
+        if (!staticCached || floor->isAnimating())
+            draw(floor.get());
+    }
+
+    // Draw ladders (over floors, below shots/balls/players)
+    appGraph.setLayer(LAYER_LADDERS);
+    if (!staticCached)
+    {
+        for (const auto& ladder : lsLadders)
+        {
+            ladder->draw(appGraph);
+        }
+    }
 
     // Draw shots using polymorphic draw() method
+    appGraph.setLayer(LAYER_SHOTS);
     for (const auto& shot : lsShoots)
     {
-        shot->draw(&appGraph);  // Polymorphic call
+        shot->draw(&appGraph, renderAlpha);  // Polymorphic call
     }
 
     // Draw balls
+    appGraph.setLayer(LAYER_BALLS);
     for (const auto& ball : lsBalls)
     {
-        draw(ball.get());
+        draw(ball);
     }
 
     // Draw hexas
+    appGraph.setLayer(LAYER_HEXAS);
     for (const auto& hexa : lsHexas)
     {
-        draw(hexa.get());
+        draw(hexa);
     }
 
     // Draw pickups (above balls, below effects)
+    appGraph.setLayer(LAYER_PICKUPS);
     for (const auto& pickup : lsPickups)
     {
-        pickup->draw(&appGraph);
+        pickup->draw(&appGraph, renderAlpha);
     }
 
     // Draw one-shot animation effects (pop sparks, muzzle flashes) above balls
+    appGraph.setLayer(LAYER_EFFECTS);
     for (const auto& effect : lsEffects)
     {
-        effect->draw(&appGraph);
+        effect->draw(&appGraph, renderAlpha);
     }
 
     // Draw floating score popups above everything
+    appGraph.setLayer(LAYER_HIT_SCORES);
     for (const auto& hs : lsHitScores)
     {
-        hs->draw(&appGraph);
+        hs->draw(&appGraph, renderAlpha);
     }
+
+    appGraph.endBatch();
 }
 
 void Scene::drawPlayers()
@@ -2023,6 +2380,7 @@ void Scene::drawHUD()
 {
     StageResources& res = gameinf.getStageRes();
 
+    // Not part of the static layer: the marks stay over balls and shots
     Scene::drawMark(appGraph, res);
     drawScore();
 
@@ -2104,8 +2462,10 @@ void Scene::updateDrawFPSCounters()
 
 int Scene::drawAll()
 {
-    drawBackground();
-    drawEntities();
+    bool staticCached = drawStaticLayer();
+    if (!staticCached)
+        drawBackground();
+    drawEntities(staticCached);
     drawHUD();
     drawPlayers();
     drawStateOverlay();
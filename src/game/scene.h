@@ -25,6 +25,13 @@
 #include "freezeeffect.h"
 #include "collisionsystem.h"
 #include "collisionrules.h"
+#include "platformindex.h"
+#include "staticlayer.h"
+#include "spatialquery.h"
+#include "random.h"
+#include "worldhash.h"
+#include "scenesnapshot.h"
+#include "entitypools.h"
 
 class StageClear;
 
@@ -99,6 +106,10 @@ public:
     static constexpr int FONT_SMALL = 1;
     static constexpr int FONT_HUGE = 2;
 
+    // Default capacities of the recycled effect pools (oldest dropped when full)
+    static constexpr int DEFAULT_MAX_EFFECTS = 128;
+    static constexpr int DEFAULT_MAX_HIT_SCORES = 32;
+
 private:
     // Collision detection tolerances (extracted magic numbers)
     static constexpr float GROUND_SNAP_TOLERANCE = 1.0f;    ///< Distance tolerance for snapping to ground
@@ -106,6 +117,17 @@ private:
     static constexpr int LADDER_ENTRY_TOLERANCE = 4;        ///< Pixel tolerance for ladder entry detection
     static constexpr int SURFACE_CHECK_WIDTH = 20;          ///< Width used for floor/ladder standing checks
 
+    // Render queue layers used by drawEntities and the static layer (lower layers draw first)
+    static constexpr int LAYER_BACKGROUND = 0;
+    static constexpr int LAYER_FLOORS = 1;
+    static constexpr int LAYER_LADDERS = 2;
+    static constexpr int LAYER_SHOTS = 3;
+    static constexpr int LAYER_BALLS = 4;
+    static constexpr int LAYER_HEXAS = 5;
+    static constexpr int LAYER_PICKUPS = 6;
+    static constexpr int LAYER_EFFECTS = 7;
+    static constexpr int LAYER_HIT_SCORES = 8;
+
     // Scene state management
     SceneState currentState;           ///< Current scene state (Ready/Playing/GameOver/LevelClear)
     GameOverSubState gameOverSubState; ///< Current game over substate (Continue/Definitive)
@@ -163,16 +185,23 @@ private:
     BMFontRenderer worldFont;   ///< Font for "WORLD X-Y" HUD display
     BMFontRenderer timeFont;    ///< Font for HUD timer display (pixelgame.fnt)
     
-    // Ball management
-    std::vector<std::unique_ptr<Ball>> pendingBalls;  ///< Buffer for balls created from splits
-
-    // Hexa management
-    std::vector<std::unique_ptr<Hexa>> pendingHexas;  ///< Buffer for hexas created from splits
-
     // Collision pipeline
     CollisionSystem collisionSystem;  ///< Detects collisions and resolves physics
+    mutable PlatformIndex platformIndex;  ///< X-sorted index over platforms/ladders (rebuilt lazily)
     CollisionRules gameRules;              ///< Processes contacts and applies game logic
 
+    // Static render layer
+    StaticLayer staticLayer;          ///< Background, platforms, ladders and marks cached in a render target
+    bool staticLayerEnabled = true;   ///< false: draw the static content every frame (/staticlayer off)
+
+    // Gameplay randomness
+    Random rng;  ///< Seeded from AppData::gameSeed and the stage id in init()
+
+    // Snapshots (restart / rewind)
+    SceneSnapshot quickSnapshot;   ///< Slot used by /snapshot and /restore
+    SceneSnapshot startSnapshot;   ///< Taken on the first Playing tick (instant restart)
+    SnapshotRing rewindRing;       ///< Recent history for /rewind (disabled by default)
+
     /**
      * @brief Validates ball spawn position against floor collisions
      * 
@@ -198,6 +227,18 @@ private:
     template<typename T>
     void cleanupDeadObjects(std::list<std::unique_ptr<T>>& list);
 
+    /**
+     * @brief Pool version of cleanupDeadObjects (swap-and-pop compaction)
+     */
+    template<typename T, size_t SlotSize, size_t SlotAlign>
+    void cleanupDeadObjects(EntityPool<T, SlotSize, SlotAlign>& pool);
+
+    /**
+     * @brief RecyclePool version of cleanupDeadObjects (objects return to the free list)
+     */
+    template<typename T>
+    void cleanupDeadObjects(RecyclePool<T>& pool);
+
     /**
      * @brief Clean up dead balls and handle ball splitting
      *
@@ -230,10 +271,22 @@ private:
     void unsubscribeFromEvents();
 
     // Helper methods for drawAll()
+    /**
+     * @brief Bring the static layer up to date and blit it
+     * @return false if the layer is disabled or unavailable (draw the content directly)
+     */
+    bool drawStaticLayer();
+
+    /**
+     * @brief Draw everything the static layer caches (background, still platforms, ladders)
+     */
+    void drawStaticContent();
+
     /**
      * @brief Draw all game entities (floors, shots, balls)
+     * @param staticCached Still platforms and ladders come from the static layer
      */
-    void drawEntities();
+    void drawEntities(bool staticCached);
 
     /**
      * @brief Draw players with visibility checks
@@ -261,6 +314,13 @@ private:
      */
     void updateFPSCounters();
 
+    /**
+     * @brief Advances the simulation by one tick (body of moveAll)
+     * @param dt Delta time in seconds
+     * @return New GameState if transitioning, nullptr otherwise
+     */
+    GameState* stepSimulation(float dt);
+
     /**
      * @brief Updates all entities (balls, shots, floors)
      * @param dt Delta time in seconds
@@ -350,14 +410,16 @@ public:
     BmNumFont fontNum[3]; ///< Bitmap fonts (small, medium, large)
 
     // Entity lists
-    std::list<std::unique_ptr<Ball>> lsBalls;       ///< Active balls in scene
-    std::list<std::unique_ptr<Hexa>> lsHexas;       ///< Active hexas in scene
-    std::list<std::unique_ptr<Pickup>> lsPickups;   ///< Active pickups in scene
+    // Dynamic entities live in pools (stable addresses, generational handles,
+    // dense iteration); static geometry stays in lists.
+    BallPool lsBalls;                               ///< Active balls in scene
+    HexaPool lsHexas;                               ///< Active hexas in scene
+    PickupPool lsPickups;                           ///< Active pickups in scene
     std::list<std::unique_ptr<Platform>> lsFloor;   ///< Active platforms (Floor and Glass)
     std::list<std::unique_ptr<Ladder>> lsLadders;   ///< Active ladders (climbable)
-    std::list<std::unique_ptr<Shot>> lsShoots;      ///< Active weapon shots
-    std::list<std::unique_ptr<AnimEffect>> lsEffects; ///< Active one-shot animations (pops, sparks)
-    std::list<std::unique_ptr<HitScore>> lsHitScores; ///< Floating score popups (ball hits)
+    ShotPool lsShoots;                              ///< Active weapon shots
+    EffectPool lsEffects{ DEFAULT_MAX_EFFECTS };        ///< Active one-shot animations (pops, sparks)
+    HitScorePool lsHitScores{ DEFAULT_MAX_HIT_SCORES }; ///< Floating score popups (ball hits)
 
     /**
      * @brief Constructs a new Scene for the given stage
@@ -435,6 +497,53 @@ public:
      */
     const std::list<std::unique_ptr<Ladder>>& getLadders() const { return lsLadders; }
 
+    /**
+     * @brief Gets the static platform/ladder index, rebuilding it if invalidated
+     * @return Const reference to the up-to-date index
+     */
+    const PlatformIndex& getPlatformIndex() const;
+
+    /**
+     * @brief Marks the platform index stale (geometry added, removed or revealed)
+     */
+    void invalidatePlatformIndex() { platformIndex.invalidate(); }
+
+    /**
+     * @brief Marks the static layer stale where a platform is drawn (revealed, breaking, removed)
+     */
+    void invalidateStaticLayer(const Platform* platform);
+
+    const StaticLayer& getStaticLayer() const { return staticLayer; }
+    bool isStaticLayerEnabled() const { return staticLayerEnabled; }
+
+    /**
+     * @brief Turn the static layer cache on or off (off frees the render target)
+     */
+    void setStaticLayerEnabled(bool enabled)
+    {
+        staticLayerEnabled = enabled;
+        if (!enabled)
+            staticLayer.release();
+    }
+
+    /**
+     * @brief Gets a query view over the static geometry (box, point, raycasts)
+     * @return View over the up-to-date platform index
+     */
+    SpatialQuery getSpatialQuery() const { return SpatialQuery(getPlatformIndex()); }
+
+    /**
+     * @brief Gets the scene's gameplay random generator
+     * @return Generator seeded from the game seed and stage id
+     */
+    Random& getRandom() { return rng; }
+
+    /**
+     * @brief Restarts the random sequence from a new game seed
+     * @param seed Base seed (combined with the stage id)
+     */
+    void reseed(Uint32 seed);
+
     /**
      * @brief Finds a ladder that the player can enter (50% overlap)
      * @param player The player to check
@@ -515,13 +624,13 @@ public:
      * @brief Creates a shot of the appropriate type based on weapon
      * 
      * Factory method that instantiates the correct Shot subclass
-     * (HarpoonShot, GunShot, etc.) based on weapon type.
+     * (HarpoonShot, GunShot, etc.) based on weapon type, in lsShoots.
      * 
      * @param pl Player firing the shot
      * @param type Weapon type
-     * @return unique_ptr to created Shot object
+     * @return Pointer to the created Shot (owned by lsShoots)
      */
-    std::unique_ptr<Shot> createShot(Player* pl, WeaponType type);
+    Shot* createShot(Player* pl, WeaponType type);
 
     /**
      * @brief Queues an ultra-fast switch to a specific stage (no StageClear/courtain)
@@ -575,6 +684,19 @@ public:
      * @return 1 on success
      */
     int drawAll() override;
+
+    /**
+     * @brief Drops the static layer cache when the renderer loses render targets
+     */
+    void onSDLEvent(const SDL_Event& e) override;
+
+    /**
+     * @brief Stores positions of moving entities before a simulation step
+     *
+     * Balls, hexas and players are drawn interpolated between the stored
+     * and the current position (see GameState::renderAlpha).
+     */
+    void storePrevPositions() override;
     
     /**
      * @brief Draws a ball sprite
@@ -632,6 +754,51 @@ public:
      */
     GameState* moveAll(float dt) override;
 
+    /**
+     * @brief Hashes the simulation state (entities, players, timers)
+     *
+     * Covers every ball/hexa/shot/pickup/floor position and state, the
+     * players' state, timeRemaining and timeLine. Used by Replay to check
+     * that a re-simulation matches the recorded run tick by tick.
+     *
+     * @return Per-category hash of the current state
+     */
+    WorldHash computeWorldHash() const;
+
+    /**
+     * @brief Whether the current state can be snapshotted
+     *
+     * Only Playing is supported, and not while a player's death animation
+     * is running (the animation's Action state is not captured).
+     */
+    bool canSnapshot() const;
+
+    /**
+     * @brief Captures entities, players, timers, freeze effect, RNG and stage cursor
+     * @param out Snapshot to overwrite (its buffers are reused)
+     * @return false if canSnapshot() is false (out is left untouched)
+     */
+    bool saveSnapshot(SceneSnapshot& out) const;
+
+    /**
+     * @brief Replaces the scene state with a snapshot taken by this Scene
+     *
+     * Also works from GameOver (the scene returns to Playing), but not
+     * while the stage-clear sequence is running, nor while a replay is
+     * being recorded or played back. Effects and score popups on screen
+     * are cleared.
+     *
+     * @param snap Snapshot to apply (it is not consumed and can be restored again)
+     * @return false if snap is empty, the scene is in LevelClear or a replay is active
+     */
+    bool restoreSnapshot(const SceneSnapshot& snap);
+
+    SceneSnapshot& getQuickSnapshot() { return quickSnapshot; }
+    const SceneSnapshot& getStartSnapshot() const { return startSnapshot; }
+    SnapshotRing& getRewindRing() { return rewindRing; }
+
+    CollisionSystem& getCollisionSystem() { return collisionSystem; }
+
     /**
      * @brief Enables/disables debug bounding box visualization
      * @param enabled True to show bounding boxes
@@ -715,4 +882,20 @@ void Scene::cleanupDeadObjects(std::list<std::unique_ptr<T>>& list)
     });
 }
 
+template<typename T, size_t SlotSize, size_t SlotAlign>
+void Scene::cleanupDeadObjects(EntityPool<T, SlotSize, SlotAlign>& pool)
+{
+    pool.removeIf([](const T* obj) {
+        return obj->isDead();
+    });
+}
+
+template<typename T>
+void Scene::cleanupDeadObjects(RecyclePool<T>& pool)
+{
+    pool.removeIf([](const T* obj) {
+        return obj->isDead();
+    });
+}
+
 #endif
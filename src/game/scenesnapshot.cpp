@@ -0,0 +1,70 @@
+#include "scenesnapshot.h"
+#include <cmath>
+
+void SnapshotRing::setSeconds(int secs)
+{
+    seconds = secs > 0 ? secs : 0;
+    int capacity = seconds * 60 / INTERVAL_TICKS;
+
+    // SceneSnapshot is not movable (its pools own fixed storage), so the
+    // ring is rebuilt rather than resized
+    std::vector<SceneSnapshot> fresh(capacity);
+    slots.swap(fresh);
+    clear();
+}
+
+void SnapshotRing::clear()
+{
+    for (SceneSnapshot& slot : slots)
+        slot.valid = false;
+
+    head = 0;
+    count = 0;
+    tickCounter = 0;
+}
+
+bool SnapshotRing::due()
+{
+    if (slots.empty())
+        return false;
+
+    if (++tickCounter < INTERVAL_TICKS)
+        return false;
+
+    tickCounter = 0;
+    return true;
+}
+
+SceneSnapshot& SnapshotRing::push()
+{
+    SceneSnapshot& slot = slots[head];
+    head = (head + 1) % (int)slots.size();
+    if (count < (int)slots.size())
+        count++;
+    return slot;
+}
+
+const SceneSnapshot* SnapshotRing::rewind(float secs)
+{
+    if (count == 0)
+        return nullptr;
+
+    // Steps back from the newest snapshot (0 = newest)
+    int steps = (int)std::lround(secs * 60.0f / INTERVAL_TICKS);
+    if (steps < 0) steps = 0;
+    if (steps > count - 1) steps = count - 1;
+
+    int size = (int)slots.size();
+    int index = ((head - 1 - steps) % size + size) % size;
+
+    // Forget everything newer than the restored snapshot
+    for (int i = 0; i < steps; i++)
+    {
+        head = (head - 1 + size) % size;
+        slots[head].valid = false;
+    }
+    count -= steps;
+    tickCounter = 0;
+
+    return slots[index].valid ? &slots[index] : nullptr;
+}
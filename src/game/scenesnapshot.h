@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "entitypools.h"
+#include "platform.h"
+#include "player.h"
+#include "stage.h"
+#include "freezeeffect.h"
+#include "random.h"
+#include "oncehelper.h"
+
+/**
+ * @struct SceneSnapshot
+ * @brief Copy of a Scene's complete simulation state
+ *
+ * Filled by Scene::saveSnapshot() and applied by Scene::restoreSnapshot().
+ * Entities are held as deep copies in pools of their own, so restoring is
+ * a matter of copying them back into the scene pools - no stage file
+ * reload and no re-running of the spawn sequence. The pools keep their
+ * chunks between saves, so re-saving into the same slot does not allocate
+ * per entity.
+ *
+ * Ladders never change after spawning, so only their count is kept;
+ * restore drops ladders spawned after the snapshot.
+ *
+ * A snapshot belongs to the Scene that took it (entities point to that
+ * Scene and its players) and is discarded with it.
+ */
+struct SceneSnapshot
+{
+    BallPool balls;
+    HexaPool hexas;
+    ShotPool shots;
+    PickupPool pickups;
+    std::vector<std::unique_ptr<Platform>> floors;
+    std::vector<int> pickupPlatforms;   ///< Index in floors of each pickup's landed platform (-1 = ground)
+    size_t ladderCount = 0;
+
+    Player::Snapshot players[2];
+    bool hasPlayer[2] = { false, false };
+
+    Stage::Cursor stageCursor = {};
+    FreezeEffect::State freeze = {};
+    Random rng;
+    OnceHelper stageOnce;
+    int timeRemaining = 0;
+    float timeLine = 0.0f;
+    float secondAccum = 0.0f;
+    bool shootKeyWasDown[2] = { false, false };
+
+    bool valid = false;   ///< False until saved
+};
+
+/**
+ * @class SnapshotRing
+ * @brief Fixed-size ring of recent SceneSnapshots for rewinding
+ *
+ * The Scene calls due() every tick; every INTERVAL_TICKS it captures a
+ * snapshot into push(). rewind() returns the snapshot closest to the
+ * requested age and forgets everything newer, so repeated rewinds walk
+ * further back in time.
+ *
+ * Slots are reused in place, so their pools and vectors keep their capacity.
+ */
+class SnapshotRing
+{
+public:
+    static constexpr int INTERVAL_TICKS = 15;  ///< Capture period (4 snapshots per second at 60 Hz)
+
+    /**
+     * @brief Resize the ring to cover the given number of seconds (0 disables)
+     */
+    void setSeconds(int seconds);
+    int getSeconds() const { return seconds; }
+    bool isEnabled() const { return !slots.empty(); }
+    int getCount() const { return count; }
+
+    /**
+     * @brief Advance the capture clock by one tick
+     * @return true when a snapshot should be captured with push()
+     */
+    bool due();
+
+    /**
+     * @brief Slot for the next snapshot (overwrites the oldest when full)
+     */
+    SceneSnapshot& push();
+
+    /**
+     * @brief Find the snapshot taken about the given number of seconds ago
+     *
+     * Snapshots newer than the returned one are dropped.
+     *
+     * @return Snapshot to restore, or nullptr if the ring is empty
+     */
+    const SceneSnapshot* rewind(float seconds);
+
+    void clear();
+
+private:
+    std::vector<SceneSnapshot> slots;
+    int seconds = 0;
+    int head = 0;          ///< Next slot to write
+    int count = 0;         ///< Valid snapshots in the ring
+    int tickCounter = 0;
+};
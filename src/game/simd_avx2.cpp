@@ -0,0 +1,35 @@
+// AVX2 variants of the SIMD kernels (ball step, circle batch). This file
+// is compiled with AVX2 code generation (see CMakeLists.txt) and only
+// called after a runtime CPU check, see BallKernel::step() and
+// CircleBatch::intersectBox().
+
+#include "ballkernel_simd.h"
+#include "circlebatch_simd.h"
+
+bool simdHasAVX2Build()
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ballKernelStepAVX2(const BallLanes& lanes, size_t count, float ticks)
+{
+#if defined(__AVX2__)
+    stepRange<PackAVX2>(lanes, 0, count, ticks);
+#else
+    stepRange<PackScalar>(lanes, 0, count, ticks);
+#endif
+}
+
+void circleBatchIntersectAVX2(const float* cx, const float* cy, const float* radius, size_t count,
+                              float x0, float y0, float x1, float y1, Uint32* mask)
+{
+#if defined(__AVX2__)
+    intersectRange<PackAVX2>(cx, cy, radius, count, x0, y0, x1, y1, mask);
+#else
+    intersectRange<PackScalar>(cx, cy, radius, count, x0, y0, x1, y1, mask);
+#endif
+}
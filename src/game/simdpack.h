@@ -0,0 +1,125 @@
+#pragma once
+
+// Private to the SIMD kernels (ballkernel, circlebatch) and simd_avx2.cpp.
+//
+// Kernels are written once against a small "pack" interface and
+// instantiated for scalar floats, SSE2 (4 lanes) and AVX2 (8 lanes).
+// Everything lives in an anonymous namespace so each translation unit
+// keeps its own copy: simd_avx2.cpp is built with AVX2 code generation
+// and must never be linked into the SSE2/scalar paths.
+//
+// bits(m) returns one bit per lane (lane 0 = bit 0), like movemask.
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMDPACK_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /**
+     * Scalar pack: one lane, plain float math (also used for the remainder)
+     */
+    struct PackScalar
+    {
+        using F = float;
+        using M = bool;
+        static constexpr int WIDTH = 1;
+
+        static F set1(float v) { return v; }
+        static F load(const float* p) { return *p; }
+        static void store(float* p, F v) { *p = v; }
+        static F add(F a, F b) { return a + b; }
+        static F sub(F a, F b) { return a - b; }
+        static F mul(F a, F b) { return a * b; }
+        static F div(F a, F b) { return a / b; }
+        static F sqrt(F a) { return std::sqrt(a); }
+        static F max(F a, F b) { return a > b ? a : b; }
+        static M lt(F a, F b) { return a < b; }
+        static M le(F a, F b) { return a <= b; }
+        static M gt(F a, F b) { return a > b; }
+        static M ge(F a, F b) { return a >= b; }
+        static M eq(F a, F b) { return a == b; }
+        static M andm(M a, M b) { return a && b; }
+        static M orm(M a, M b) { return a || b; }
+        static M andnotm(M a, M b) { return !a && b; }   // (!a) & b
+        static F select(M m, F a, F b) { return m ? a : b; }
+        static M selectm(M m, M a, M b) { return m ? a : b; }
+        static bool any(M m) { return m; }
+        static int bits(M m) { return m ? 1 : 0; }
+    };
+
+#ifdef SIMDPACK_SSE2
+    /**
+     * SSE2 pack: 4 lanes
+     */
+    struct PackSSE2
+    {
+        using F = __m128;
+        using M = __m128;
+        static constexpr int WIDTH = 4;
+
+        static F set1(float v) { return _mm_set1_ps(v); }
+        static F load(const float* p) { return _mm_loadu_ps(p); }
+        static void store(float* p, F v) { _mm_storeu_ps(p, v); }
+        static F add(F a, F b) { return _mm_add_ps(a, b); }
+        static F sub(F a, F b) { return _mm_sub_ps(a, b); }
+        static F mul(F a, F b) { return _mm_mul_ps(a, b); }
+        static F div(F a, F b) { return _mm_div_ps(a, b); }
+        static F sqrt(F a) { return _mm_sqrt_ps(a); }
+        static F max(F a, F b) { return _mm_max_ps(a, b); }     // a > b ? a : b
+        static M lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+        static M le(F a, F b) { return _mm_cmple_ps(a, b); }
+        static M gt(F a, F b) { return _mm_cmpgt_ps(a, b); }
+        static M ge(F a, F b) { return _mm_cmpge_ps(a, b); }
+        static M eq(F a, F b) { return _mm_cmpeq_ps(a, b); }
+        static M andm(M a, M b) { return _mm_and_ps(a, b); }
+        static M orm(M a, M b) { return _mm_or_ps(a, b); }
+        static M andnotm(M a, M b) { return _mm_andnot_ps(a, b); }
+        static F select(M m, F a, F b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+        static M selectm(M m, M a, M b) { return select(m, a, b); }
+        static bool any(M m) { return _mm_movemask_ps(m) != 0; }
+        static int bits(M m) { return _mm_movemask_ps(m); }
+    };
+#endif
+
+#if defined(__AVX2__)
+    /**
+     * AVX2 pack: 8 lanes
+     */
+    struct PackAVX2
+    {
+        using F = __m256;
+        using M = __m256;
+        static constexpr int WIDTH = 8;
+
+        static F set1(float v) { return _mm256_set1_ps(v); }
+        static F load(const float* p) { return _mm256_loadu_ps(p); }
+        static void store(float* p, F v) { _mm256_storeu_ps(p, v); }
+        static F add(F a, F b) { return _mm256_add_ps(a, b); }
+        static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+        static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+        static F div(F a, F b) { return _mm256_div_ps(a, b); }
+        static F sqrt(F a) { return _mm256_sqrt_ps(a); }
+        static F max(F a, F b) { return _mm256_max_ps(a, b); }
+        static M lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        static M le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+        static M gt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        static M ge(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+        static M eq(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        static M andm(M a, M b) { return _mm256_and_ps(a, b); }
+        static M orm(M a, M b) { return _mm256_or_ps(a, b); }
+        static M andnotm(M a, M b) { return _mm256_andnot_ps(a, b); }
+        static F select(M m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+        static M selectm(M m, M a, M b) { return select(m, a, b); }
+        static bool any(M m) { return _mm256_movemask_ps(m) != 0; }
+        static int bits(M m) { return _mm256_movemask_ps(m); }
+    };
+#endif
+}
@@ -0,0 +1,65 @@
+#include "spatialquery.h"
+
+Platform* SpatialQuery::firstInBox(const CollisionBox& box, unsigned filter) const
+{
+    return firstInBox(box, filter, [](const PlatformIndex::PlatformEntry&) { return true; });
+}
+
+Platform* SpatialQuery::platformAt(int x, int y, unsigned filter) const
+{
+    RayHit best;
+    queryPoint(x, y, [&](const PlatformIndex::PlatformEntry& entry)
+    {
+        if (entry.order < best.order)
+            best = { entry.platform, entry.box.y, entry.order };
+    }, filter);
+    return best.platform;
+}
+
+bool SpatialQuery::raycastDown(int left, int right, int fromY, int toY, RayHit& hit, unsigned filter) const
+{
+    RayHit best;
+    best.y = toY;
+
+    querySpan(left, right, [&](const PlatformIndex::PlatformEntry& entry)
+    {
+        int top = entry.box.y;
+        if (top < fromY)
+            return;
+
+        if (top < best.y || (best.platform && top == best.y && entry.order < best.order))
+            best = { entry.platform, top, entry.order };
+    }, filter);
+
+    if (!best.platform)
+        return false;
+    hit = best;
+    return true;
+}
+
+bool SpatialQuery::raycastUp(int left, int right, int fromY, int toY, RayHit& hit, unsigned filter) const
+{
+    RayHit best;
+    best.y = toY;
+
+    querySpan(left, right, [&](const PlatformIndex::PlatformEntry& entry)
+    {
+        int bottom = entry.box.y + entry.box.h;
+        if (bottom > fromY)
+            return;
+
+        if (bottom > best.y || (best.platform && bottom == best.y && entry.order < best.order))
+            best = { entry.platform, bottom, entry.order };
+    }, filter);
+
+    if (!best.platform)
+        return false;
+    hit = best;
+    return true;
+}
+
+Platform* SpatialQuery::nearestPlatformBelow(int left, int right, int fromY, unsigned filter) const
+{
+    RayHit hit;
+    return raycastDown(left, right, fromY, Stage::MAX_Y + 1, hit, filter) ? hit.platform : nullptr;
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <climits>
+#include "../core/collisionbox.h"
+#include "platformindex.h"
+#include "platform.h"
+#include "stage.h"
+
+/**
+ * @class SpatialQuery
+ * @brief Read-only spatial queries against the static stage geometry
+ *
+ * Thin view over a PlatformIndex that answers the questions gameplay code
+ * asks about platforms: which ones overlap a box or a point, which one a
+ * vertical ray hits first, and which one is the nearest below a span.
+ * Every query only visits the index entries whose X range touches the
+ * query, and returns its result through a callback or a single value, so
+ * nothing is allocated.
+ *
+ * All "first" / "nearest" results break ties by position in the scene's
+ * platform list, so they match the linear scans they replace.
+ *
+ * Dead platforms are always skipped. Invisible platforms are skipped unless
+ * INCLUDE_INVISIBLE is set; SKIP_PASSTHROUGH additionally drops platforms
+ * the player can walk through.
+ *
+ * Obtain one from Scene::getSpatialQuery(); it is only valid until the
+ * next geometry change (the index it refers to may be rebuilt).
+ */
+class SpatialQuery
+{
+public:
+    /// Platform filter flags (combine with |)
+    enum Filter : unsigned
+    {
+        SOLID             = 0,        ///< Alive and visible platforms (default)
+        INCLUDE_INVISIBLE = 1u << 0,  ///< Also report invisible (not yet revealed) platforms
+        SKIP_PASSTHROUGH  = 1u << 1,  ///< Skip passthrough platforms
+    };
+
+    /**
+     * @brief Result of a vertical raycast
+     */
+    struct RayHit
+    {
+        Platform* platform = nullptr;
+        int y = 0;                  ///< Surface hit: platform top (down) or bottom (up)
+        int order = INT_MAX;        ///< Position in the scene's platform list
+    };
+
+    explicit SpatialQuery(const PlatformIndex& index) : index(index) {}
+
+    /**
+     * @brief Visit platforms overlapping [left, right] by at least one pixel
+     * @param fn Callable taking (const PlatformIndex::PlatformEntry&), visited in X order
+     */
+    template <typename Fn>
+    void querySpan(int left, int right, Fn&& fn, unsigned filter = SOLID) const
+    {
+        index.forEachPlatform(left, right, [&](const PlatformIndex::PlatformEntry& entry)
+        {
+            if (accepts(entry.platform, filter) &&
+                calculateHorizontalOverlap(left, right, entry.box.x, entry.box.x + entry.box.w) > 0)
+                fn(entry);
+        });
+    }
+
+    /**
+     * @brief Visit platforms whose collision box intersects box (see intersects())
+     * @param fn Callable taking (const PlatformIndex::PlatformEntry&), visited in X order
+     */
+    template <typename Fn>
+    void queryBox(const CollisionBox& box, Fn&& fn, unsigned filter = SOLID) const
+    {
+        index.forEachPlatform(box.x, box.x + box.w, [&](const PlatformIndex::PlatformEntry& entry)
+        {
+            if (accepts(entry.platform, filter) && intersects(box, entry.box))
+                fn(entry);
+        });
+    }
+
+    /**
+     * @brief Visit platforms containing the point (see contains())
+     * @param fn Callable taking (const PlatformIndex::PlatformEntry&), visited in X order
+     */
+    template <typename Fn>
+    void queryPoint(int x, int y, Fn&& fn, unsigned filter = SOLID) const
+    {
+        index.forEachPlatform(x, x, [&](const PlatformIndex::PlatformEntry& entry)
+        {
+            if (accepts(entry.platform, filter) && contains(entry.box, (float)x, (float)y))
+                fn(entry);
+        });
+    }
+
+    /**
+     * @brief First platform in list order overlapping [left, right] that satisfies pred
+     * @param pred Callable taking (const PlatformIndex::PlatformEntry&) returning bool
+     */
+    template <typename Pred>
+    Platform* firstInSpan(int left, int right, unsigned filter, Pred&& pred) const
+    {
+        RayHit best;
+        querySpan(left, right, [&](const PlatformIndex::PlatformEntry& entry)
+        {
+            if (entry.order < best.order && pred(entry))
+                best = { entry.platform, entry.box.y, entry.order };
+        }, filter);
+        return best.platform;
+    }
+
+    /**
+     * @brief First platform in list order intersecting box that satisfies pred
+     * @param pred Callable taking (const PlatformIndex::PlatformEntry&) returning bool
+     */
+    template <typename Pred>
+    Platform* firstInBox(const CollisionBox& box, unsigned filter, Pred&& pred) const
+    {
+        RayHit best;
+        queryBox(box, [&](const PlatformIndex::PlatformEntry& entry)
+        {
+            if (entry.order < best.order && pred(entry))
+                best = { entry.platform, entry.box.y, entry.order };
+        }, filter);
+        return best.platform;
+    }
+
+    /**
+     * @brief First platform in list order intersecting box
+     */
+    Platform* firstInBox(const CollisionBox& box, unsigned filter = SOLID) const;
+
+    /**
+     * @brief First platform in list order containing the point
+     */
+    Platform* platformAt(int x, int y, unsigned filter = SOLID) const;
+
+    /**
+     * @brief Cast the span [left, right] downwards from fromY
+     *
+     * Hits platforms overlapping the span by at least one pixel whose top
+     * lies in [fromY, toY). The nearest top wins; ties go to the earliest
+     * platform in list order.
+     *
+     * @return true if a platform was hit (hit is left untouched otherwise)
+     */
+    bool raycastDown(int left, int right, int fromY, int toY, RayHit& hit, unsigned filter = SOLID) const;
+
+    /**
+     * @brief Cast the span [left, right] upwards from fromY
+     *
+     * Hits platforms overlapping the span by at least one pixel whose
+     * bottom lies in (toY, fromY]. The nearest bottom wins; ties go to the
+     * earliest platform in list order.
+     *
+     * @return true if a platform was hit (hit is left untouched otherwise)
+     */
+    bool raycastUp(int left, int right, int fromY, int toY, RayHit& hit, unsigned filter = SOLID) const;
+
+    /**
+     * @brief Nearest platform whose top is at or below fromY (down to Stage::MAX_Y)
+     * @return The platform, or nullptr if only the stage floor is below
+     */
+    Platform* nearestPlatformBelow(int left, int right, int fromY, unsigned filter = SOLID) const;
+
+private:
+    static bool accepts(const Platform* platform, unsigned filter)
+    {
+        if (platform->isDead())
+            return false;
+        if (platform->isInvisible() && !(filter & INCLUDE_INVISIBLE))
+            return false;
+        if (platform->isPassthrough() && (filter & SKIP_PASSTHROUGH))
+            return false;
+        return true;
+    }
+
+    const PlatformIndex& index;
+};
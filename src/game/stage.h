@@ -423,6 +423,18 @@ public:
      */
     int getItemsLeft() const { return itemsleft; }
 
+    /**
+     * Sequence playback position (saved and restored by scene snapshots)
+     */
+    struct Cursor
+    {
+        size_t sequenceIndex;
+        int itemsLeft;
+    };
+
+    Cursor getCursor() const { return { sequenceIndex, itemsleft }; }
+    void setCursor(const Cursor& c) { sequenceIndex = c.sequenceIndex; itemsleft = c.itemsLeft; }
+
     /**
      * Set background image file
      * @param backFile Path to background image (relative to graph/ folder)
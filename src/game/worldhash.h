@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstring>
+#include <SDL.h>
+
+/**
+ * @struct WorldHash
+ * @brief Fingerprint of the simulation state after one Scene tick
+ *
+ * The state is hashed per entity category rather than as a single value,
+ * so a mismatch between two runs names the category that diverged first
+ * (e.g. "Balls" after a change to Ball::update, "Shots" after a change to
+ * the shot/floor collision rules).
+ *
+ * Produced by Scene::computeWorldHash(), stored per tick in replay files
+ * and compared during playback (see Replay).
+ */
+struct WorldHash
+{
+    enum Part
+    {
+        Balls,
+        Hexas,
+        Shots,
+        Pickups,
+        Floors,
+        Players,
+        Timers,
+        PART_COUNT
+    };
+
+    Uint32 parts[PART_COUNT] = {};
+
+    bool operator==(const WorldHash& o) const { return std::memcmp(parts, o.parts, sizeof(parts)) == 0; }
+    bool operator!=(const WorldHash& o) const { return !(*this == o); }
+
+    static const char* partName(int part)
+    {
+        static const char* names[PART_COUNT] = {
+            "Balls", "Hexas", "Shots", "Pickups", "Floors", "Players", "Timers"
+        };
+        return (part >= 0 && part < PART_COUNT) ? names[part] : "?";
+    }
+};
+
+/**
+ * @class StateHasher
+ * @brief Streaming FNV-1a hash over ints and floats
+ *
+ * Floats are hashed by bit pattern, so any change in the simulation
+ * (even in the last ulp) changes the hash.
+ */
+class StateHasher
+{
+private:
+    Uint32 h = 2166136261u;
+
+public:
+    void add(Uint32 v)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            h ^= (v >> (i * 8)) & 0xFF;
+            h *= 16777619u;
+        }
+    }
+
+    void add(int v) { add((Uint32)v); }
+    void add(bool v) { add((Uint32)(v ? 1 : 0)); }
+
+    void add(float v)
+    {
+        Uint32 bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        add(bits);
+    }
+
+    Uint32 get() const { return h; }
+};
@@ -17,7 +17,7 @@ int main(int argc, char* argv[])
     
     
     GameRunner runner;
-    int result = runner.run();
+    int result = runner.parseArguments(argc, argv) ? runner.run() : 1;
     
     LOG_INFO("Game exited with code: %d", result);
     
@@ -5,6 +5,7 @@
 #include "logger.h"
 #include "main.h"
 #include "eventmanager.h"
+#include "debugcommands.h"
 #include <algorithm>
 #include <sstream>
 
@@ -190,6 +191,29 @@ void AppConsole::registerBuiltinCommands()
 
     registerCommand("shield", "Toggle player shield: /shield [player_num] [0|1]",
         [this](const std::string& args) { cmdShield(args); });
+
+    registerCommand("seed", "Show or set the gameplay random seed: /seed [value]",
+        [this](const std::string& args) { cmdSeed(args); });
+
+    registerCommand("snapshot", "Save the scene state to the quick slot: /snapshot",
+        [this](const std::string& args) { cmdSnapshot(args); });
+
+    registerCommand("restore", "Restore the quick slot (or stage start): /restore [start]",
+        [this](const std::string& args) { cmdRestore(args); });
+
+    registerCommand("rewind", "Rewind history: /rewind on [seconds] | off | <seconds back>",
+        [this](const std::string& args) { cmdRewind(args); });
+    registerCommand("fxpool", "Show or set effect/score popup pool capacity: /fxpool [effects] [scores]",
+        [this](const std::string& args) { cmdFxPool(args); });
+    registerCommand("atlas", "Texture atlas packing stats and texture switches in the last frame",
+        [this](const std::string& args) { cmdAtlas(args); });
+    registerCommand("renderstats", "Render cost of recent frames (draw calls, textures, overdraw, flip): /renderstats [reset|csv FILE]",
+        [this](const std::string& args) { cmdRenderStats(args); });
+    registerCommand("staticlayer", "Show static layer cache stats, or turn it on/off: /staticlayer [on|off]",
+        [this](const std::string& args) { cmdStaticLayer(args); });
+
+    // Checks and benchmarks live in their own module
+    DebugCommands::registerAll(*this);
 }
 
 void AppConsole::cmdHelp(const std::string& args)
@@ -909,6 +933,347 @@ void AppConsole::print(const std::string& message, LogColor color)
     LOG_INFO("%s", message.c_str());
 }
 
+/**
+ * Command: /fxpool [effects] [scores]
+ *
+ * Shows usage of the recycled effect and score popup pools: live objects,
+ * capacity and how many live ones were dropped (recycled early) because
+ * the pool was full. With arguments, sets new capacities; this clears
+ * the effects currently on screen.
+ */
+void AppConsole::cmdFxPool(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/fxpool can only be used during gameplay (Scene)");
+        return;
+    }
+
+    int effects = 0, scores = 0;
+    std::istringstream iss(args);
+    if (iss >> effects)
+    {
+        iss >> scores;
+        if (effects > 0)
+            scene->lsEffects.setCapacity(effects);
+        if (scores > 0)
+            scene->lsHitScores.setCapacity(scores);
+        LOG_SUCCESS("Effect pool capacity %d, score popup pool capacity %d",
+                    (int)scene->lsEffects.capacity(), (int)scene->lsHitScores.capacity());
+    }
+
+    LOG_INFO("Effects:      %3d / %3d live, %llu dropped", (int)scene->lsEffects.size(),
+             (int)scene->lsEffects.capacity(), (unsigned long long)scene->lsEffects.getDropped());
+    LOG_INFO("Score popups: %3d / %3d live, %llu dropped", (int)scene->lsHitScores.size(),
+             (int)scene->lsHitScores.capacity(), (unsigned long long)scene->lsHitScores.getDropped());
+}
+
+/**
+ * Command: /atlas
+ *
+ * Shows how the stage resources were packed into the texture atlas
+ * (textures before and after, pages, fill) and how many texture switches
+ * the last frame needed. Start with --no-atlas to get the unpacked
+ * switch count for comparison.
+ */
+void AppConsole::cmdAtlas(const std::string& args)
+{
+    AppData& appData = AppData::instance();
+    const TextureAtlas& atlas = appData.atlas;
+
+    if (atlas.isBuilt())
+    {
+        const TextureAtlas::Stats& st = atlas.getStats();
+        LOG_INFO("Atlas: %d sprites, %d regions in %d page(s), %.0f%% filled",
+                 st.sprites, st.regions, st.pages, st.fill * 100.0);
+        LOG_INFO("  Stage resource textures: %d before, %d after (%d regions too large to pack)",
+                 st.sourceTextures, st.texturesAfter, st.skipped);
+    }
+    else
+    {
+        LOG_INFO("Atlas: not built (%s)", appData.useAtlas ? "headless or unsupported renderer" : "--no-atlas");
+    }
+
+    LOG_INFO("Texture switches last frame: %u", (unsigned)appData.graph.getTextureSwitches());
+    LOG_INFO("Draw calls last frame: %u", (unsigned)appData.graph.getDrawCalls());
+}
+
+/**
+ * Command: /renderstats [reset|csv FILE]
+ *
+ * Summarises the render counters Graph kept for the recent frames (up to
+ * RenderStats::HISTORY_FRAMES): mean and peak draw calls, texture switches,
+ * distinct textures, quads, untextured primitives, overdraw estimate and
+ * time spent in flip(). "reset" clears the history; "csv FILE" writes it
+ * one row per frame (also done on exit with --render-csv FILE).
+ */
+void AppConsole::cmdRenderStats(const std::string& args)
+{
+    RenderStats& stats = AppData::instance().graph.getRenderStats();
+
+    std::string action, path;
+    std::istringstream iss(args);
+    iss >> action >> path;
+
+    if (action == "reset")
+    {
+        stats.clear();
+        LOG_INFO("Render stats history cleared");
+        return;
+    }
+    if (action == "csv")
+    {
+        if (path.empty())
+            path = "renderstats.csv";
+        if (stats.writeCsv(path, RES_X, RES_Y))
+            LOG_SUCCESS("%u frames written to %s", (unsigned)stats.size(), path.c_str());
+        else
+            LOG_ERROR("Could not write %s", path.c_str());
+        return;
+    }
+
+    RenderStats::Summary sum = stats.summarize();
+    if (sum.frames == 0)
+    {
+        LOG_INFO("No frames recorded yet");
+        return;
+    }
+
+    const RenderStats::Frame& mean = sum.mean;
+    const RenderStats::Frame& peak = sum.peak;
+    LOG_INFO("=== Render stats: last %u frames (mean / peak) ===", (unsigned)sum.frames);
+    LOG_INFO("  Draw calls:       %6u / %u", (unsigned)mean.drawCalls, (unsigned)peak.drawCalls);
+    LOG_INFO("  Texture switches: %6u / %u", (unsigned)mean.textureSwitches, (unsigned)peak.textureSwitches);
+    LOG_INFO("  Textures bound:   %6u / %u", (unsigned)mean.texturesBound, (unsigned)peak.texturesBound);
+    LOG_INFO("  Quads:            %6u / %u", (unsigned)mean.quads, (unsigned)peak.quads);
+    LOG_INFO("  Primitives:       %6u / %u  (%llu / %llu px filled)",
+             (unsigned)mean.primitives, (unsigned)peak.primitives,
+             (unsigned long long)mean.primitivePixels, (unsigned long long)peak.primitivePixels);
+    LOG_INFO("  Overdraw:         %6.2fx / %.2fx  (sprite area / screen)",
+             mean.overdraw(RES_X, RES_Y), peak.overdraw(RES_X, RES_Y));
+    LOG_INFO("  flip():           %6.2f / %.2f ms", mean.flipMs, peak.flipMs);
+}
+
+/**
+ * Command: /staticlayer [on|off]
+ *
+ * Shows how often the cached static layer (background, platforms, ladders)
+ * was blitted and redrawn. "off" draws that content every
+ * frame again, for comparison with /renderstats; "on" restores the cache.
+ */
+void AppConsole::cmdStaticLayer(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/staticlayer can only be used during gameplay (Scene)");
+        return;
+    }
+
+    std::string action;
+    std::istringstream iss(args);
+    iss >> action;
+
+    if (action == "on" || action == "off")
+    {
+        scene->setStaticLayerEnabled(action == "on");
+        LOG_INFO("Static layer %s", scene->isStaticLayerEnabled() ? "enabled" : "disabled");
+        return;
+    }
+
+    const StaticLayer& layer = scene->getStaticLayer();
+    const StaticLayer::Stats& st = layer.getStats();
+    LOG_INFO("Static layer: %s", !scene->isStaticLayerEnabled() ? "disabled" :
+             layer.isCreated() ? "cached" : "not created (no render target support)");
+    LOG_INFO("  Blits: %llu  Full redraws: %llu  Region redraws: %llu  Pixels redrawn: %llu",
+             (unsigned long long)st.blits, (unsigned long long)st.fullRedraws,
+             (unsigned long long)st.regionRedraws, (unsigned long long)st.pixelsRedrawn);
+}
+
+/**
+ * Command: /seed [value]
+ *
+ * Without argument, prints the current gameplay seed.
+ * With a value, sets the game seed and restarts the current Scene's
+ * random sequence from it (stages started afterwards use it as well).
+ */
+void AppConsole::cmdSeed(const std::string& args)
+{
+    AppData& appData = AppData::instance();
+
+    if (args.empty())
+    {
+        LOG_INFO("Game seed: %u", appData.gameSeed);
+        return;
+    }
+
+    unsigned long value = 0;
+    try
+    {
+        value = std::stoul(args);
+    }
+    catch (const std::exception&)
+    {
+        LOG_WARNING("Invalid seed: %s (must be a non-negative integer)", args.c_str());
+        return;
+    }
+
+    appData.gameSeed = (Uint32)value;
+
+    if (Scene* scene = dynamic_cast<Scene*>(appData.currentScreen.get()))
+        scene->reseed(appData.gameSeed);
+
+    LOG_SUCCESS("Game seed set to %u", appData.gameSeed);
+}
+
+/**
+ * Command: /snapshot
+ *
+ * Captures the current scene state (entities, players, timers, RNG and
+ * stage sequence position) into the quick slot. Only works while playing.
+ */
+void AppConsole::cmdSnapshot(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/snapshot can only be used during gameplay (Scene)");
+        return;
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (!scene->saveSnapshot(scene->getQuickSnapshot()))
+    {
+        LOG_WARNING("Cannot snapshot now (only while playing, not during a player death)");
+        return;
+    }
+    double us = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / (double)SDL_GetPerformanceFrequency();
+
+    LOG_SUCCESS("Snapshot saved (%.1f us)", us);
+}
+
+/**
+ * Command: /restore [start]
+ *
+ * Restores the quick slot saved with /snapshot, or with "start" the state
+ * captured on the first playing tick of the stage (instant restart).
+ */
+void AppConsole::cmdRestore(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/restore can only be used during gameplay (Scene)");
+        return;
+    }
+    if (gameinf.replay.isRecording() || gameinf.replay.isPlaying())
+    {
+        LOG_WARNING("Cannot restore while a replay is recording or playing");
+        return;
+    }
+
+    bool fromStart = (args == "start");
+    const SceneSnapshot& snap = fromStart ? scene->getStartSnapshot() : scene->getQuickSnapshot();
+    if (!snap.valid)
+    {
+        LOG_WARNING("%s", fromStart ? "No stage start snapshot yet" : "No snapshot saved (use /snapshot first)");
+        return;
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (!scene->restoreSnapshot(snap))
+    {
+        LOG_WARNING("Cannot restore during the stage clear sequence");
+        return;
+    }
+    double us = (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / (double)SDL_GetPerformanceFrequency();
+
+    LOG_SUCCESS("%s restored (%.1f us)", fromStart ? "Stage start" : "Snapshot", us);
+}
+
+/**
+ * Command: /rewind on [seconds] | off | <seconds>
+ *
+ * "on" keeps a ring of snapshots covering the last N seconds (default 10),
+ * "off" disables it, and a number rewinds that many seconds back.
+ */
+void AppConsole::cmdRewind(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/rewind can only be used during gameplay (Scene)");
+        return;
+    }
+
+    SnapshotRing& ring = scene->getRewindRing();
+    std::istringstream iss(args);
+    std::string first;
+    iss >> first;
+
+    if (first.empty())
+    {
+        if (ring.isEnabled())
+            LOG_INFO("Rewind: on, %d s history (%d snapshots stored)", ring.getSeconds(), ring.getCount());
+        else
+            LOG_INFO("Rewind: off (use /rewind on [seconds])");
+        return;
+    }
+
+    if (first == "on")
+    {
+        int seconds = 10;
+        iss >> seconds;
+        if (seconds <= 0)
+        {
+            LOG_WARNING("History length must be positive");
+            return;
+        }
+        ring.setSeconds(seconds);
+        LOG_SUCCESS("Rewind enabled: %d s history", seconds);
+        return;
+    }
+
+    if (first == "off")
+    {
+        ring.setSeconds(0);
+        LOG_SUCCESS("Rewind disabled");
+        return;
+    }
+
+    float seconds = 0.0f;
+    try
+    {
+        seconds = std::stof(first);
+    }
+    catch (const std::exception&)
+    {
+        LOG_WARNING("Usage: /rewind on [seconds] | off | <seconds>");
+        return;
+    }
+
+    if (!ring.isEnabled())
+    {
+        LOG_WARNING("Rewind is off (use /rewind on [seconds])");
+        return;
+    }
+    if (gameinf.replay.isRecording() || gameinf.replay.isPlaying())
+    {
+        LOG_WARNING("Cannot rewind while a replay is recording or playing");
+        return;
+    }
+
+    const SceneSnapshot* snap = ring.rewind(seconds);
+    if (!snap || !scene->restoreSnapshot(*snap))
+    {
+        LOG_WARNING("Nothing to rewind to");
+        return;
+    }
+
+    LOG_SUCCESS("Rewound %.1f s (%d snapshots left)", seconds, ring.getCount());
+}
+
 void AppConsole::registerCommand(const std::string& name, const std::string& desc, CommandHandler handler)
 {
     // Check if command already exists
@@ -116,6 +116,14 @@ private:
     void cmdFloor(const std::string& args);
     void cmdImmune(const std::string& args);
     void cmdShield(const std::string& args);
+    void cmdSeed(const std::string& args);
+    void cmdSnapshot(const std::string& args);
+    void cmdRestore(const std::string& args);
+    void cmdRewind(const std::string& args);
+    void cmdFxPool(const std::string& args);
+    void cmdAtlas(const std::string& args);
+    void cmdRenderStats(const std::string& args);
+    void cmdStaticLayer(const std::string& args);
 
     /**
      * @brief Validates and queues an ultra-fast stage switch by relative offset.
@@ -38,9 +38,10 @@ SDL_Rect BmNumFont::getRect(char numChar) const
 
     if (code >= 0 && code <= 9)
     {
-        rcchr.y = 0;
+        // Offsets are relative to the sprite's region (it may sit in an atlas)
+        rcchr.y = sprite->getSrcY();
         rcchr.h = sprite->getHeight();
-        rcchr.x = offsets[code];
+        rcchr.x = sprite->getSrcX() + offsets[code];
         if (code == numChars - 1)
             rcchr.w = sprite->getWidth() - offsets[code];
         else
@@ -393,16 +394,83 @@ void BMFontRenderer::setScale(float s)
     scale = s;
 }
 
+SDL_Texture* BMFontRenderer::createSystemFontTexture(SDL_Renderer* renderer)
+{
+    const int numGlyphs = 95;
+    const int rows = (numGlyphs + SYSTEM_GLYPH_COLS - 1) / SYSTEM_GLYPH_COLS;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, SYSTEM_GLYPH_COLS * SYSTEM_CELL_W,
+                                                          rows * SYSTEM_CELL_H, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface)
+    {
+        LOG_WARNING("System font texture surface failed: %s", SDL_GetError());
+        return nullptr;
+    }
+
+    // Fresh surfaces are zeroed: fully transparent
+    Uint32 lit = SDL_MapRGBA(surface->format, 255, 255, 255, 255);
+    for (int idx = 0; idx < numGlyphs; idx++)
+    {
+        int cellX = (idx % SYSTEM_GLYPH_COLS) * SYSTEM_CELL_W;
+        int cellY = (idx / SYSTEM_GLYPH_COLS) * SYSTEM_CELL_H;
+        for (int row = 0; row < SYSTEM_GLYPH_H; row++)
+        {
+            Uint32* line = (Uint32*)((Uint8*)surface->pixels + (cellY + row) * surface->pitch);
+            unsigned char bits = g_systemFont5x7[idx][row];
+            for (int col = 0; col < SYSTEM_GLYPH_W; col++)
+            {
+                if (bits & (0x80 >> col))
+                    line[cellX + col] = lit;
+            }
+        }
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!texture)
+    {
+        LOG_WARNING("System font texture failed: %s", SDL_GetError());
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
 void BMFontRenderer::renderSystemFont(const char* texto, int x, int y)
 {
     if (!graph) return;
-    
-    SDL_SetRenderDrawColor(graph->getRenderer(), colorR, colorG, colorB, colorA);
-    
+
     int currentX = x;
     int charWidth = 6;  // 5 pixels + 1 pixel spacing
     int pixelScale = (int)scale;
     if (pixelScale < 1) pixelScale = 1;
+
+    // Glyph texture: one tinted quad per character, the string as one batch
+    if (SDL_Texture* glyphs = graph->getSystemFontTexture())
+    {
+        SDL_Color color = { colorR, colorG, colorB, colorA };
+        graph->beginBatch();
+        for (int i = 0; texto[i] != '\0'; i++)
+        {
+            unsigned char c = (unsigned char)texto[i];
+            if (c > 32 && c <= 126)
+            {
+                int idx = c - 32;
+                SDL_Rect srcRect = { (idx % SYSTEM_GLYPH_COLS) * SYSTEM_CELL_W, (idx / SYSTEM_GLYPH_COLS) * SYSTEM_CELL_H,
+                                     SYSTEM_GLYPH_W, SYSTEM_GLYPH_H };
+                SDL_Rect dstRect = { currentX, y, SYSTEM_GLYPH_W * pixelScale, SYSTEM_GLYPH_H * pixelScale };
+                graph->drawTinted(glyphs, srcRect, dstRect, color);
+            }
+            currentX += charWidth * pixelScale;
+        }
+        graph->endBatch();
+        return;
+    }
+
+    // No glyph texture: one filled rectangle per lit pixel. Untextured, so
+    // anything queued so far is flushed first to stay below the text
+    graph->flushBatch();
+
+    SDL_SetRenderDrawColor(graph->getRenderer(), colorR, colorG, colorB, colorA);
     
     for (int i = 0; texto[i] != '\0'; i++)
     {
@@ -428,6 +496,7 @@ void BMFontRenderer::renderSystemFont(const char* texto, int x, int y)
                         pixelScale 
                     };
                     SDL_RenderFillRect(graph->getRenderer(), &pixel);
+                    graph->countPrimitive(1, (Uint64)pixelScale * pixelScale);
                 }
             }
         }
@@ -462,9 +531,10 @@ void BMFontRenderer::text(const char* texto, int x, int y, TextAlign align)
         return;
     }
     
-    // Use BMFont rendering
-    SDL_SetTextureColorMod(fontTexture->getBmp(), colorR, colorG, colorB);
-    SDL_SetTextureAlphaMod(fontTexture->getBmp(), colorA);
+    // Use BMFont rendering: the glyphs of a string go out as one batch,
+    // tinted through the quad color instead of the texture's color mod
+    SDL_Color color = { colorR, colorG, colorB, colorA };
+    graph->beginBatch();
 
     int currentX = x;
     
@@ -483,7 +553,7 @@ void BMFontRenderer::text(const char* texto, int x, int y, TextAlign align)
                 static_cast<int>(ch->height * scale) 
             };
 
-            SDL_RenderCopy(graph->getRenderer(), fontTexture->getBmp(), &srcRect, &dstRect);
+            graph->drawTinted(fontTexture->getBmp(), srcRect, dstRect, color);
             currentX += (int)(ch->xadvance * scale);
         }
         else
@@ -492,8 +562,7 @@ void BMFontRenderer::text(const char* texto, int x, int y, TextAlign align)
         }
     }
 
-    SDL_SetTextureColorMod(fontTexture->getBmp(), 255, 255, 255);
-    SDL_SetTextureAlphaMod(fontTexture->getBmp(), 255);
+    graph->endBatch();
 }
 
 int BMFontRenderer::getTextWidth(const char* texto) const
@@ -145,7 +145,26 @@ private:
     void renderSystemFont(const char* texto, int x, int y);
     int getSystemFontTextWidth(const char* texto) const;
 
+    // System font glyph texture layout (1 px gap keeps scaled glyphs from bleeding)
+    static constexpr int SYSTEM_GLYPH_W = 5;
+    static constexpr int SYSTEM_GLYPH_H = 7;
+    static constexpr int SYSTEM_CELL_W = SYSTEM_GLYPH_W + 1;
+    static constexpr int SYSTEM_CELL_H = SYSTEM_GLYPH_H + 1;
+    static constexpr int SYSTEM_GLYPH_COLS = 16;
+
 public:
+    /**
+     * @brief Rasterise the built-in 5x7 font (ASCII 32-126) into a glyph texture
+     *
+     * Lit pixels are opaque white, the rest transparent, so strings are
+     * tinted with the quad color (or the texture's color mod). Graph creates
+     * it at init and owns it; system font text is then drawn as one quad per
+     * character instead of one filled rectangle per pixel.
+     *
+     * @return New texture, or nullptr on failure (text falls back to filled rectangles)
+     */
+    static SDL_Texture* createSystemFontTexture(SDL_Renderer* renderer);
+
     BMFontRenderer();
     ~BMFontRenderer() { release(); }
     
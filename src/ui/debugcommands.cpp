@@ -0,0 +1,798 @@
+#include "debugcommands.h"
+#include "appconsole.h"
+#include "logger.h"
+#include "main.h"
+#include "alloccounter.h"
+#include "benchutil.h"
+#include "circlebatch.h"
+#include "collisionstress.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+void DebugCommands::registerAll(AppConsole& console)
+{
+    console.registerCommand("collbench", "Benchmark collision detection (brute force vs grid): /collbench [ticks]",
+        [](const std::string& args) { cmdCollBench(args); });
+    console.registerCommand("physcheck", "Compare ball/hexa trajectories at 60 Hz and 240 Hz: /physcheck [seconds]",
+        [](const std::string& args) { cmdPhysCheck(args); });
+    console.registerCommand("ballbench", "Benchmark ball motion (Ball::update vs SoA/SIMD kernel): /ballbench [ticks]",
+        [](const std::string& args) { cmdBallBench(args); });
+    console.registerCommand("circlebench", "Benchmark ball circle vs box tests (per pair vs SIMD batch): /circlebench [boxes]",
+        [](const std::string& args) { cmdCircleBench(args); });
+    console.registerCommand("collallocs", "Heap allocations inside the collision pipeline (Debug): /collallocs [reset]",
+        [](const std::string& args) { cmdCollAllocs(args); });
+    console.registerCommand("sweepcheck", "Count platform tunneling at coarse timesteps, discrete vs swept: /sweepcheck [seconds]",
+        [](const std::string& args) { cmdSweepCheck(args); });
+    console.registerCommand("querybench", "Benchmark static geometry queries (linear scan vs SpatialQuery): /querybench [probes]",
+        [](const std::string& args) { cmdQueryBench(args); });
+    console.registerCommand("collstress", "Collision stress benchmark on synthetic worlds, JSON output: /collstress [ticks] [file]",
+        [](const std::string& args) { cmdCollStress(args); });
+    console.registerCommand("animbench", "Benchmark per-frame animation updates and state switches: /animbench [entities] [frames]",
+        [](const std::string& args) { cmdAnimBench(args); });
+}
+
+/**
+ * Command: /collbench [ticks]
+ *
+ * Benchmarks CollisionSystem::detectAndResolve against the current stage's
+ * platforms with 10, 100, 1000 and 5000 synthetic balls, once with the
+ * broadphase grid disabled (brute force) and once enabled.
+ * Both runs start from identical ball sets and must produce the same contacts.
+ * Only works during gameplay (Scene).
+ */
+void DebugCommands::cmdCollBench(const std::string& args)
+{
+    AppData& appData = AppData::instance();
+    Scene* scene = dynamic_cast<Scene*>(appData.currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("Collbench command only available during gameplay");
+        return;
+    }
+
+    int ticks = 100;
+    std::istringstream iss(args);
+    iss >> ticks;
+    if (ticks < 1) ticks = 1;
+
+    static const int BALL_COUNTS[] = { 10, 100, 1000, 5000 };
+
+    LOG_INFO("=== Collision benchmark: %d platforms, %d ticks ===", (int)scene->lsFloor.size(), ticks);
+
+    for (int numBalls : BALL_COUNTS)
+    {
+        double usPerTick[2] = { 0.0, 0.0 };
+        size_t totalContacts[2] = { 0, 0 };
+
+        for (int mode = 0; mode < 2; mode++)
+        {
+            // Same seed for both modes so the ball sets are identical
+            Random rng(BenchUtil::SEED);
+            BallPool balls;
+            HexaPool hexas;
+            ShotPool shots;
+            PickupPool pickups;
+            BenchUtil::spawnRandomBalls(balls, scene, numBalls, rng);
+
+            CollisionSystem system;
+            system.setBroadphaseEnabled(mode == 1);
+            CollisionSystem::Context ctx = { balls, hexas, shots, scene->lsFloor, pickups, { nullptr, nullptr }, false };
+
+            Uint64 start = SDL_GetPerformanceCounter();
+            for (int t = 0; t < ticks; t++)
+            {
+                const ContactList& contacts = system.detectAndResolve(ctx);
+                totalContacts[mode] += contacts.size();
+            }
+            usPerTick[mode] = BenchUtil::elapsedUs(start) / ticks;
+        }
+
+        double speedup = usPerTick[1] > 0.0 ? usPerTick[0] / usPerTick[1] : 0.0;
+        LOG_INFO("  %5d balls: brute %9.1f us/tick  grid %9.1f us/tick  (x%.1f)  contacts %d%s",
+                 numBalls, usPerTick[0], usPerTick[1], speedup, (int)totalContacts[1],
+                 totalContacts[0] == totalContacts[1] ? "" : " MISMATCH");
+    }
+}
+
+/**
+ * Command: /physcheck [seconds]
+ *
+ * Checks that ball and hexa motion does not depend on the timestep: every
+ * ball size and hexa size is simulated once at 60 Hz and once at 240 Hz
+ * (four quarter steps per tick), and the positions are compared after each
+ * 60 Hz tick. The largest deviation must stay under one pixel.
+ */
+void DebugCommands::cmdPhysCheck(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/physcheck can only be used during gameplay (Scene)");
+        return;
+    }
+
+    int seconds = 20;
+    std::istringstream iss(args);
+    iss >> seconds;
+    if (seconds < 1) seconds = 1;
+
+    const int ticks = seconds * GameState::GLOBAL_UPDATE_FRAMERATE;
+    const float dt60 = 1.0f / GameState::GLOBAL_UPDATE_FRAMERATE;
+    const float dt240 = dt60 / 4.0f;
+    bool allOk = true;
+
+    for (int size = 0; size < 4; size++)
+    {
+        BallPool balls;
+        Ball* a = balls.emplace(scene, 120 + size * 60, 100, size, size & 1 ? -1.0f : 1.0f, 1);
+        Ball* b = balls.emplace(*a);
+
+        float maxErr = 0.0f;
+        for (int t = 0; t < ticks; t++)
+        {
+            a->update(dt60);
+            for (int i = 0; i < 4; i++)
+                b->update(dt240);
+            maxErr = std::max(maxErr, std::max(std::fabs(a->getX() - b->getX()), std::fabs(a->getY() - b->getY())));
+        }
+
+        bool ok = maxErr < 1.0f;
+        allOk = allOk && ok;
+        LOG_INFO("  Ball size %d: max deviation %.3f px %s", size, maxErr, ok ? "" : "(FAIL)");
+    }
+
+    for (int size = 0; size < 3; size++)
+    {
+        Hexa a(scene, 150 + size * 80, 120, size, size & 1 ? -1.5f : 1.5f, 1.0f);
+        std::unique_ptr<Hexa> b = a.clone();
+
+        float maxErr = 0.0f;
+        for (int t = 0; t < ticks; t++)
+        {
+            a.update(dt60);
+            for (int i = 0; i < 4; i++)
+                b->update(dt240);
+            maxErr = std::max(maxErr, std::max(std::fabs(a.getX() - b->getX()), std::fabs(a.getY() - b->getY())));
+        }
+
+        bool ok = maxErr < 1.0f;
+        allOk = allOk && ok;
+        LOG_INFO("  Hexa size %d: max deviation %.3f px %s", size, maxErr, ok ? "" : "(FAIL)");
+    }
+
+    if (allOk)
+        LOG_SUCCESS("60 Hz and 240 Hz trajectories match within a pixel over %d s", seconds);
+    else
+        LOG_ERROR("60 Hz and 240 Hz trajectories differ by a pixel or more");
+}
+
+/**
+ * Command: /ballbench [ticks]
+ *
+ * Microbenchmark of ball motion at 1k, 10k and 100k balls: Ball::update()
+ * per object versus stepping the pool's motion store in place, as Scene
+ * does (BallKernel::step(), scalar and SIMD). Also checks that the kernel
+ * leaves every ball's motion state (position, time, y0, direction)
+ * bit-identical to Ball::update().
+ */
+void DebugCommands::cmdBallBench(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/ballbench can only be used during gameplay (Scene)");
+        return;
+    }
+
+    int ticks = 60;
+    std::istringstream iss(args);
+    iss >> ticks;
+    if (ticks < 1) ticks = 1;
+
+    static const int BALL_COUNTS[] = { 1000, 10000, 100000 };
+    const float dt = 1.0f / GameState::GLOBAL_UPDATE_FRAMERATE;
+
+    LOG_INFO("=== Ball kernel benchmark: %d ticks, SIMD path %s ===", ticks, BallKernel::isaName());
+
+    for (int numBalls : BALL_COUNTS)
+    {
+        // Three identical pools, one per path
+        BallPool objectBalls, scalarBalls, simdBalls;
+        for (BallPool* pool : { &objectBalls, &scalarBalls, &simdBalls })
+        {
+            Random rng(BenchUtil::SEED);
+            BenchUtil::spawnRandomBalls(*pool, scene, numBalls, rng);
+        }
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int t = 0; t < ticks; t++)
+        {
+            for (Ball* ball : objectBalls)
+                ball->update(dt);
+        }
+        double objectUs = BenchUtil::elapsedUs(start) / ticks;
+
+        auto runKernel = [&](BallPool& pool)
+        {
+            Uint64 kernelStart = SDL_GetPerformanceCounter();
+            for (int t = 0; t < ticks; t++)
+                pool.getMotion().step(dt);
+            return BenchUtil::elapsedUs(kernelStart) / ticks;
+        };
+
+        BallKernel::setForceScalar(true);
+        double scalarUs = runKernel(scalarBalls);
+        BallKernel::setForceScalar(false);
+        double simdUs = runKernel(simdBalls);
+
+        // Compare bit patterns, not values: the kernel must match exactly
+        auto sameBits = [](float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; };
+        auto sameMotion = [&](const Ball* a, const Ball* b)
+        {
+            return sameBits(a->getX(), b->getX()) && sameBits(a->getY(), b->getY()) &&
+                   sameBits(a->getTime(), b->getTime()) && sameBits(a->getY0(), b->getY0()) &&
+                   sameBits(a->getDirX(), b->getDirX()) && a->getDirY() == b->getDirY();
+        };
+        int mismatches = 0;
+        for (int i = 0; i < numBalls; i++)
+        {
+            if (!sameMotion(objectBalls[i], scalarBalls[i]) || !sameMotion(objectBalls[i], simdBalls[i]))
+                mismatches++;
+        }
+
+        LOG_INFO("  %6d balls: Ball::update %9.1f us/tick  SoA scalar %9.1f  SoA %s %9.1f  (x%.1f)%s",
+                 numBalls, objectUs, scalarUs, BallKernel::isaName(), simdUs,
+                 simdUs > 0.0 ? objectUs / simdUs : 0.0,
+                 BenchUtil::identicalSuffix(mismatches));
+        if (mismatches)
+            LOG_ERROR("  %d of %d balls differ from Ball::update", mismatches, numBalls);
+    }
+}
+
+/**
+ * Command: /circlebench [boxes]
+ *
+ * Microbenchmark of the ball collision test at 1k, 10k and 100k circles:
+ * circleIntersectsBox() per pair versus CircleBatch (scalar and SIMD), each
+ * against the same random boxes. Also checks that every batch hit mask
+ * matches circleIntersectsBox() exactly.
+ */
+void DebugCommands::cmdCircleBench(const std::string& args)
+{
+    int numBoxes = 64;
+    std::istringstream iss(args);
+    iss >> numBoxes;
+    if (numBoxes < 1) numBoxes = 1;
+
+    static const int CIRCLE_COUNTS[] = { 1000, 10000, 100000 };
+
+    LOG_INFO("=== Circle batch benchmark: %d boxes, SIMD path %s ===", numBoxes, CircleBatch::isaName());
+
+    for (int numCircles : CIRCLE_COUNTS)
+    {
+        // Ball-sized circles and platform/player-sized boxes over the playfield
+        Random rng(BenchUtil::SEED);
+        auto randX = [&]() { return rng.range(Stage::MIN_X - 32, Stage::MAX_X + 33); };
+        auto randY = [&]() { return rng.range(Stage::MIN_Y - 32, Stage::MAX_Y + 33); };
+        auto randSize = [&]() { return rng.range(0, 97); };
+
+        std::vector<int> cx(numCircles), cy(numCircles), radius(numCircles);
+        CircleBatch batch;
+        batch.reserve(numCircles);
+        for (int i = 0; i < numCircles; i++)
+        {
+            cx[i] = randX();
+            cy[i] = randY();
+            radius[i] = rng.range(4, 25);
+            batch.add(cx[i], cy[i], radius[i]);
+        }
+
+        std::vector<CollisionBox> boxes(numBoxes);
+        for (CollisionBox& box : boxes)
+            box = { randX(), randY(), randSize(), randSize() };
+
+        std::vector<Uint32> mask;
+        int pairHits = 0;
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (const CollisionBox& box : boxes)
+        {
+            for (int i = 0; i < numCircles; i++)
+                pairHits += circleIntersectsBox(cx[i], cy[i], radius[i], box) ? 1 : 0;
+        }
+        double pairUs = BenchUtil::elapsedUs(start);
+
+        CircleBatch::setForceScalar(true);
+        start = SDL_GetPerformanceCounter();
+        for (const CollisionBox& box : boxes)
+            batch.intersectBox(box, mask);
+        double scalarUs = BenchUtil::elapsedUs(start);
+        CircleBatch::setForceScalar(false);
+
+        start = SDL_GetPerformanceCounter();
+        for (const CollisionBox& box : boxes)
+            batch.intersectBox(box, mask);
+        double simdUs = BenchUtil::elapsedUs(start);
+
+        // Equivalence: every bit of both batch paths against the reference
+        int mismatches = 0;
+        for (int pass = 0; pass < 2; pass++)
+        {
+            CircleBatch::setForceScalar(pass == 0);
+            for (const CollisionBox& box : boxes)
+            {
+                batch.intersectBox(box, mask);
+                for (int i = 0; i < numCircles; i++)
+                {
+                    bool hit = (mask[i / 32] & (1u << (i % 32))) != 0;
+                    if (hit != circleIntersectsBox(cx[i], cy[i], radius[i], box))
+                        mismatches++;
+                }
+            }
+        }
+        CircleBatch::setForceScalar(false);
+
+        LOG_INFO("  %6d circles: per pair %9.1f us  batch scalar %9.1f  batch %s %9.1f  (x%.1f, %d hits)%s",
+                 numCircles, pairUs, scalarUs, CircleBatch::isaName(), simdUs,
+                 simdUs > 0.0 ? pairUs / simdUs : 0.0, pairHits,
+                 BenchUtil::identicalSuffix(mismatches));
+        if (mismatches)
+            LOG_ERROR("  %d circle/box results differ from circleIntersectsBox", mismatches);
+    }
+}
+
+/**
+ * Command: /collallocs [reset]
+ *
+ * Shows how many heap allocations the scene's CollisionSystem made inside
+ * detectAndResolve since the last reset. Buffers only grow while the
+ * entity counts reach a new high, so in steady-state play the count of
+ * allocating calls should stop increasing. Needs a Debug build
+ * (see AllocCounter).
+ */
+void DebugCommands::cmdCollAllocs(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/collallocs can only be used during gameplay (Scene)");
+        return;
+    }
+
+    if (!AllocCounter::isEnabled())
+    {
+        LOG_WARNING("Allocation counting is only available in Debug builds");
+        return;
+    }
+
+    CollisionSystem& system = scene->getCollisionSystem();
+    if (args == "reset")
+    {
+        system.resetAllocStats();
+        LOG_SUCCESS("Collision allocation stats reset");
+        return;
+    }
+
+    const CollisionSystem::AllocStats& stats = system.getAllocStats();
+    LOG_INFO("Collision pipeline: %llu calls, %llu allocating, %llu allocations (last call: %llu)",
+             (unsigned long long)stats.calls, (unsigned long long)stats.allocatingCalls,
+             (unsigned long long)stats.allocations, (unsigned long long)stats.lastAllocations);
+
+    if (stats.calls > 0 && stats.lastAllocations == 0)
+        LOG_SUCCESS("Last call was allocation-free");
+}
+
+/**
+ * Command: /sweepcheck [seconds]
+ *
+ * Replaces the current world with a row of 16 px glass platforms and fast
+ * balls and hexas, then runs it through Scene::moveAll() (the real game
+ * step) at 1, 2, 4 and 8 ticks per step, once with discrete collision only
+ * and once with swept collision. Counts how often an entity crosses the
+ * row and stays on the other side (tunneling); a crossing undone by the
+ * next step is a swept contact resolved one step later, since detection
+ * runs before movement. With the sweep enabled the count must be 0 at
+ * every step size. The world is restored afterwards.
+ */
+void DebugCommands::cmdSweepCheck(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/sweepcheck can only be used during gameplay (Scene)");
+        return;
+    }
+    if (gameinf.replay.isRecording() || gameinf.replay.isPlaying())
+    {
+        LOG_WARNING("/sweepcheck cannot run while a replay is recording or playing");
+        return;
+    }
+
+    SceneSnapshot saved;
+    if (!scene->canSnapshot() || !scene->saveSnapshot(saved))
+    {
+        LOG_WARNING("/sweepcheck needs a world that can be snapshotted (not during the stage clear sequence)");
+        return;
+    }
+
+    int seconds = 10;
+    std::istringstream iss(args);
+    iss >> seconds;
+    if (seconds < 1) seconds = 1;
+
+    static const int STEP_TICKS[] = { 1, 2, 4, 8 };
+    const int rowY = (Stage::MIN_Y + Stage::MAX_Y) / 2;
+    CollisionSystem& system = scene->getCollisionSystem();
+    const bool sweepWasEnabled = system.isSweepEnabled();
+    bool allOk = true;
+    bool aborted = false;
+
+    LOG_INFO("=== Sweep check: %d s, glass row at y=%d ===", seconds, rowY);
+
+    for (int stepTicks : STEP_TICKS)
+    {
+        int tunnels[2] = { 0, 0 };
+
+        for (int mode = 0; mode < 2 && !aborted; mode++)
+        {
+            // Test world: the saved state without its entities and platforms
+            scene->restoreSnapshot(saved);
+            scene->lsBalls.clear();
+            scene->lsHexas.clear();
+            scene->lsShoots.clear();
+            scene->lsPickups.clear();
+            scene->lsFloor.clear();
+            for (int x = Stage::MIN_X; x < Stage::MAX_X; x += 64)
+                scene->addGlass(std::min(x, Stage::MAX_X - 64), rowY, GlassType::HORIZ_BIG);
+            int rowTop = rowY;
+            int rowBottom = rowY + scene->lsFloor.front()->getCollisionBox().h;
+
+            for (int i = 0; i < 8; i++)
+            {
+                int x = Stage::MIN_X + 20 + i * 40;
+                scene->addBall(x, Stage::MIN_Y + 4, i % 4, 0, (i & 1) ? 3.0f : -3.0f, 1);
+                scene->addHexa(x, Stage::MAX_Y - 60, 2, (i & 1) ? 2.0f : -2.0f, -6.0f);
+            }
+            for (int i = 0; i < 2; i++)
+            {
+                Player* player = gameinf.getPlayer(i);
+                if (player)
+                    player->setImmuneCounter(1 << 30);
+            }
+            scene->setTimeRemaining(seconds + 100);
+            system.setSweepEnabled(mode == 1);
+
+            // Which side of the row an entity's center is on (-1 above, 1 below, 0 inside),
+            // for the last two steps
+            auto rowSide = [&](float cy) { return cy < rowTop ? -1 : (cy > rowBottom ? 1 : 0); };
+            struct History { int before = 0; int last = 0; int seen = 0; };
+            std::map<const IGameObject*, History> sides;
+            auto observe = [&](const IGameObject* obj, float cy)
+            {
+                History& h = sides[obj];
+                int side = rowSide(cy);
+                // Crossed in the previous step and still there: not undone by a late bounce
+                if (h.seen >= 2 && h.before * h.last < 0 && side == h.last)
+                    tunnels[mode]++;
+                h.before = h.last;
+                h.last = side;
+                h.seen++;
+            };
+
+            const float dt = (float)stepTicks / GameState::GLOBAL_UPDATE_FRAMERATE;
+            int steps = seconds * GameState::GLOBAL_UPDATE_FRAMERATE / stepTicks;
+            for (int t = 0; t < steps; t++)
+            {
+                std::unique_ptr<GameState> next(scene->moveAll(dt));
+                if (next)
+                {
+                    LOG_WARNING("The scene left gameplay during the check (step %d)", t);
+                    aborted = true;
+                    break;
+                }
+
+                for (Ball* b : scene->lsBalls)
+                    observe(b, b->getY() + b->getDiameter() / 2.0f);
+                for (Hexa* h : scene->lsHexas)
+                    observe(h, h->getY() + h->getHeight() / 2.0f);
+            }
+        }
+        if (aborted)
+            break;
+
+        bool ok = tunnels[1] == 0;
+        allOk = allOk && ok;
+        LOG_INFO("  %d tick(s)/step: discrete %4d tunnels  swept %4d tunnels%s",
+                 stepTicks, tunnels[0], tunnels[1], ok ? "" : "  (FAIL)");
+    }
+
+    system.setSweepEnabled(sweepWasEnabled);
+    scene->restoreSnapshot(saved);
+    scene->getRewindRing().clear();   // Holds snapshots of the test world
+
+    if (aborted)
+        LOG_ERROR("Sweep check aborted");
+    else if (allOk)
+        LOG_SUCCESS("No tunneling with swept collision");
+    else
+        LOG_ERROR("Entities passed through platforms with swept collision enabled");
+}
+
+/**
+ * Command: /querybench [probes]
+ *
+ * Times the static-geometry queries gameplay runs every tick (ground below
+ * a span, box overlap, point, ray up) against the current stage: a linear
+ * scan of every platform versus SpatialQuery over the platform index. Each
+ * probe is a player-sized box at a random position; both answers must be
+ * the same platform.
+ */
+void DebugCommands::cmdQueryBench(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/querybench can only be used during gameplay (Scene)");
+        return;
+    }
+
+    int numProbes = 100000;
+    std::istringstream iss(args);
+    iss >> numProbes;
+    if (numProbes < 1) numProbes = 1;
+
+    Random rng(BenchUtil::SEED);
+    std::vector<CollisionBox> probes(numProbes);
+    for (CollisionBox& probe : probes)
+    {
+        int x = rng.range(Stage::MIN_X, Stage::MAX_X + 1);
+        int y = rng.range(Stage::MIN_Y, Stage::MAX_Y + 1);
+        probe = { x, y, 20, 32 };
+    }
+
+    const SpatialQuery query = scene->getSpatialQuery();
+
+    auto solid = [](const Platform* p) { return !p->isDead() && !p->isInvisible(); };
+
+    // Linear references: first match in list order, like the scans SpatialQuery replaced
+    auto linearBelow = [&](const CollisionBox& b) -> Platform*
+    {
+        Platform* best = nullptr;
+        int bestY = Stage::MAX_Y + 1;
+        for (const auto& fl : scene->lsFloor)
+        {
+            if (!solid(fl.get())) continue;
+            CollisionBox fb = fl->getCollisionBox();
+            if (fb.y < b.y || fb.y >= bestY) continue;
+            if (calculateHorizontalOverlap(b.x, b.x + b.w, fb.x, fb.x + fb.w) < 1) continue;
+            best = fl.get();
+            bestY = fb.y;
+        }
+        return best;
+    };
+    auto linearBox = [&](const CollisionBox& b) -> Platform*
+    {
+        for (const auto& fl : scene->lsFloor)
+        {
+            if (solid(fl.get()) && intersects(b, fl->getCollisionBox()))
+                return fl.get();
+        }
+        return nullptr;
+    };
+    auto linearPoint = [&](const CollisionBox& b) -> Platform*
+    {
+        for (const auto& fl : scene->lsFloor)
+        {
+            if (solid(fl.get()) && contains(fl->getCollisionBox(), (float)b.x, (float)b.y))
+                return fl.get();
+        }
+        return nullptr;
+    };
+    auto linearUp = [&](const CollisionBox& b) -> Platform*
+    {
+        Platform* best = nullptr;
+        int bestY = Stage::MIN_Y - 1;
+        for (const auto& fl : scene->lsFloor)
+        {
+            if (!solid(fl.get())) continue;
+            CollisionBox fb = fl->getCollisionBox();
+            int bottom = fb.y + fb.h;
+            if (bottom > b.y || bottom <= bestY) continue;
+            if (calculateHorizontalOverlap(b.x, b.x + b.w, fb.x, fb.x + fb.w) < 1) continue;
+            best = fl.get();
+            bestY = bottom;
+        }
+        return best;
+    };
+
+    auto indexBelow = [&](const CollisionBox& b) { return query.nearestPlatformBelow(b.x, b.x + b.w, b.y); };
+    auto indexBox = [&](const CollisionBox& b) { return query.firstInBox(b); };
+    auto indexPoint = [&](const CollisionBox& b) { return query.platformAt(b.x, b.y); };
+    auto indexUp = [&](const CollisionBox& b) -> Platform*
+    {
+        SpatialQuery::RayHit hit;
+        return query.raycastUp(b.x, b.x + b.w, b.y, Stage::MIN_Y - 1, hit) ? hit.platform : nullptr;
+    };
+
+    LOG_INFO("=== Spatial query benchmark: %d platforms, %d probes ===",
+             (int)scene->lsFloor.size(), numProbes);
+
+    auto run = [&](const char* name, auto linear, auto indexed)
+    {
+        std::vector<Platform*> expected(numProbes);
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int i = 0; i < numProbes; i++)
+            expected[i] = linear(probes[i]);
+        double linearUs = BenchUtil::elapsedUs(start);
+
+        int mismatches = 0;
+        start = SDL_GetPerformanceCounter();
+        for (int i = 0; i < numProbes; i++)
+            mismatches += (indexed(probes[i]) != expected[i]) ? 1 : 0;
+        double indexUs = BenchUtil::elapsedUs(start);
+
+        LOG_INFO("  %-8s linear %8.3f us/query  index %8.3f us/query  (x%.1f)%s",
+                 name, linearUs / numProbes, indexUs / numProbes,
+                 indexUs > 0.0 ? linearUs / indexUs : 0.0,
+                 BenchUtil::identicalSuffix(mismatches));
+        if (mismatches)
+            LOG_ERROR("  %d %s results differ from the linear scan", mismatches, name);
+    };
+
+    run("below", linearBelow, indexBelow);
+    run("box", linearBox, indexBox);
+    run("point", linearPoint, indexPoint);
+    run("rayup", linearUp, indexUp);
+}
+
+/**
+ * Command: /collstress [ticks] [file]
+ *
+ * Runs the CollisionStress scenario matrix (synthetic worlds: 100 to 5000
+ * balls, 16 or 64 platforms on a grid or at random, 8 shots per weapon
+ * type, two players) and logs ns per detectAndResolve, contacts
+ * per second and steady-state allocations per tick (Debug builds).
+ * The results are also written as JSON (default: collstress.json) so
+ * runs from different commits can be compared.
+ */
+void DebugCommands::cmdCollStress(const std::string& args)
+{
+    int ticks = 200;
+    std::string path = "collstress.json";
+    std::istringstream iss(args);
+    iss >> ticks >> path;
+    if (ticks < 1) ticks = 1;
+
+    CollisionStress::runAll(ticks, path);
+}
+
+/**
+ * Command: /animbench [entities] [frames]
+ *
+ * Clones every animation template of the stage resources (balls, hexas,
+ * shots, sparks, shields, ...) plus the players' active animations
+ * round-robin until there are `entities` instances (default 1000), then
+ * times `frames` (default 600) 60 Hz update passes over all of them.
+ * Also times state switches on the state machine clones, by name
+ * (string lookup) and by interned StateId.
+ */
+void DebugCommands::cmdAnimBench(const std::string& args)
+{
+    Scene* scene = dynamic_cast<Scene*>(AppData::instance().currentScreen.get());
+    if (!scene)
+    {
+        LOG_WARNING("/animbench can only be used during gameplay (Scene)");
+        return;
+    }
+
+    int numEntities = 1000, frames = 600;
+    std::istringstream iss(args);
+    iss >> numEntities >> frames;
+    if (numEntities < 1) numEntities = 1;
+    if (frames < 1) frames = 1;
+
+    const StageResources& res = gameinf.getStageRes();
+    std::vector<const AnimSpriteSheet*> templates;
+    auto addTemplate = [&](const AnimSpriteSheet* t) { if (t) templates.push_back(t); };
+    for (const auto& t : res.ballAnim) addTemplate(t.get());
+    for (const auto& t : res.ballSplashAnim) addTemplate(t.get());
+    for (const auto& t : res.hexaAnim) addTemplate(t.get());
+    for (const auto& t : res.hexaSplashAnim) addTemplate(t.get());
+    for (const auto& t : res.glassAnim) addTemplate(t.get());
+    addTemplate(res.gunBulletAnim.get());
+    addTemplate(res.clawWeaponAnim.get());
+    addTemplate(res.gunSparkAnim.get());
+    addTemplate(res.harpoonSparkAnim.get());
+    addTemplate(res.pickupShieldAnim.get());
+    addTemplate(res.shieldAnim.get());
+    for (int i = 0; i < 2; i++)
+    {
+        if (Player* pl = gameinf.getPlayer(i))
+            addTemplate(pl->getActiveAnim());
+    }
+
+    if (templates.empty())
+    {
+        LOG_WARNING("No animation templates loaded");
+        return;
+    }
+
+    std::vector<std::unique_ptr<AnimSpriteSheet>> anims;
+    anims.reserve(numEntities);
+    for (int i = 0; i < numEntities; i++)
+    {
+        if (auto copy = templates[i % templates.size()]->clone())
+            anims.push_back(std::move(copy));
+    }
+
+    const float dtMs = 1000.0f / 60.0f;
+
+    LOG_INFO("=== Animation benchmark: %d instances of %d templates, %d frames ===",
+             (int)anims.size(), (int)templates.size(), frames);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int f = 0; f < frames; f++)
+    {
+        for (auto& anim : anims)
+            anim->update(dtMs);
+    }
+    double updateUs = BenchUtil::elapsedUs(start);
+    LOG_INFO("  update   %8.2f us/frame  %6.1f ns/entity", updateUs / frames,
+             updateUs * 1000.0 / ((double)frames * anims.size()));
+
+    // State switches: cycle each state machine through its states, once by
+    // name and once by id (names are resolved outside the timed loops)
+    struct Switcher
+    {
+        AnimSpriteSheet* anim;
+        std::vector<std::string> names;
+        std::vector<StateMachineAnim::StateId> ids;
+    };
+    std::vector<Switcher> switchers;
+    for (auto& anim : anims)
+    {
+        auto* sm = dynamic_cast<StateMachineAnim*>(anim->getAnimController());
+        if (!sm || sm->getStateCount() < 2)
+            continue;
+
+        Switcher sw{ anim.get(), {}, {} };
+        for (StateMachineAnim::StateId id = 0; id < sm->getStateCount(); id++)
+        {
+            sw.names.push_back(sm->getStateName(id));
+            sw.ids.push_back(id);
+        }
+        switchers.push_back(std::move(sw));
+    }
+
+    if (switchers.empty())
+    {
+        LOG_INFO("  (no multi-state animations loaded, state switches not measured)");
+        return;
+    }
+
+    long long switches = 0;
+    start = SDL_GetPerformanceCounter();
+    for (int f = 0; f < frames; f++)
+    {
+        for (Switcher& sw : switchers)
+        {
+            sw.anim->setState(sw.names[f % sw.names.size()]);
+            switches++;
+        }
+    }
+    double byNameUs = BenchUtil::elapsedUs(start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int f = 0; f < frames; f++)
+    {
+        for (Switcher& sw : switchers)
+            sw.anim->setState(sw.ids[f % sw.ids.size()]);
+    }
+    double byIdUs = BenchUtil::elapsedUs(start);
+
+    LOG_INFO("  setState %8.1f ns by name  %8.1f ns by id  (x%.1f, %lld switches)",
+             byNameUs * 1000.0 / switches, byIdUs * 1000.0 / switches,
+             byIdUs > 0.0 ? byNameUs / byIdUs : 0.0, switches);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+
+class AppConsole;
+
+/**
+ * DebugCommands class
+ *
+ * Developer checks and benchmarks for the in-game console. They build
+ * synthetic worlds or time engine internals against the current Scene and
+ * only report through the log; none of them is needed to play.
+ *
+ * Kept apart from AppConsole so the console itself only deals with
+ * input, rendering and gameplay commands.
+ */
+class DebugCommands
+{
+public:
+    /**
+     * @brief Register every check and benchmark command with the console
+     */
+    static void registerAll(AppConsole& console);
+
+private:
+    static void cmdCollBench(const std::string& args);
+    static void cmdPhysCheck(const std::string& args);
+    static void cmdBallBench(const std::string& args);
+    static void cmdCircleBench(const std::string& args);
+    static void cmdCollAllocs(const std::string& args);
+    static void cmdSweepCheck(const std::string& args);
+    static void cmdQueryBench(const std::string& args);
+    static void cmdCollStress(const std::string& args);
+    static void cmdAnimBench(const std::string& args);
+};
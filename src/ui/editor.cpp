@@ -1450,8 +1450,7 @@ void Editor::drawDeathPickupIcons(const EditorObject& obj)
         if (hw < 1) hw = 1;
         if (hh < 1) hh = 1;
 
-        SDL_Rect dst = { iconX, iconY - hh, hw, hh };
-        SDL_RenderCopy(appGraph.getRenderer(), spr->getBmp(), nullptr, &dst);
+        appGraph.drawScaled(spr, iconX, iconY - hh, hw, hh);
 
         if (!isGlass)
         {
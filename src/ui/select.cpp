@@ -35,10 +35,7 @@ int SelectPlayer::init()
     initDelay = 40;
 
     setUpdateFrameRate(GLOBAL_UPDATE_FRAMERATE);
-    difTime1 = 0; 
-    difTime2 = msPerFrame;
-    time1 = SDL_GetTicks() + msPerFrame;
-    time2 = SDL_GetTicks();
+    doPause();
 
     delay = 13;
     delayCounter = 0;